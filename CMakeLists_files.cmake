@@ -41,6 +41,7 @@ if(ENABLE_ECL_INPUT)
   list(APPEND MAIN_SOURCE_FILES
     src/opm/json/JsonObject.cpp
     src/opm/parser/eclipse/Deck/Deck.cpp
+    src/opm/parser/eclipse/Deck/DeckCache.cpp
     src/opm/parser/eclipse/Deck/DeckItem.cpp
     src/opm/parser/eclipse/Deck/DeckValue.cpp
     src/opm/parser/eclipse/Deck/DeckKeyword.cpp
@@ -140,6 +141,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/parser/eclipse/EclipseState/Tables/Tables.cpp
     src/opm/parser/eclipse/EclipseState/Tables/Rock2dTable.cpp
     src/opm/parser/eclipse/EclipseState/Tables/Rock2dtrTable.cpp
+    src/opm/parser/eclipse/EclipseState/Util/NameIndex.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQASTNode.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParams.cpp
     src/opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQParser.cpp
@@ -273,6 +275,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/ConnectionTests.cpp
     tests/parser/COMPSEGUnits.cpp
     tests/parser/CopyRegTests.cpp
+    tests/parser/DeckCacheTests.cpp
     tests/parser/DeckValueTests.cpp
     tests/parser/DeckTests.cpp
     tests/parser/DynamicStateTests.cpp
@@ -295,6 +298,7 @@ if(ENABLE_ECL_INPUT)
     tests/parser/MultiRegTests.cpp
     tests/parser/MultisegmentWellTests.cpp
     tests/parser/MULTREGTScannerTests.cpp
+    tests/parser/NameIndexTests.cpp
     tests/parser/OrderedMapTests.cpp
     tests/parser/ParseContextTests.cpp
     tests/parser/ParseContext_EXIT1.cpp
@@ -490,6 +494,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Util/Value.hpp
        opm/parser/eclipse/EclipseState/Util/IOrderSet.hpp
        opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp
+       opm/parser/eclipse/EclipseState/Util/NameIndex.hpp
        opm/parser/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp
        opm/parser/eclipse/EclipseState/Edit/EDITNNC.hpp
        opm/parser/eclipse/EclipseState/Grid/GridDims.hpp
@@ -644,6 +649,7 @@ if(ENABLE_ECL_INPUT)
        opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp
        opm/parser/eclipse/Deck/DeckItem.hpp
        opm/parser/eclipse/Deck/Deck.hpp
+       opm/parser/eclipse/Deck/DeckCache.hpp
        opm/parser/eclipse/Deck/Section.hpp
        opm/parser/eclipse/Deck/DeckOutput.hpp
        opm/parser/eclipse/Deck/DeckValue.hpp
@@ -61,6 +61,9 @@ std::vector<keyword> load_deck(const char * deck_file) {
     parseContext.update(Opm::ParseContext::SUMMARY_UNKNOWN_WELL, Opm::InputError::WARN);
     parseContext.update(Opm::ParseContext::SUMMARY_UNKNOWN_GROUP, Opm::InputError::WARN);
 
+    /* The data of grid property keywords is hashed as text, without tokenizing it. */
+    parser.deferDataKeywords(true);
+
     auto deck = parser.parseFile(deck_file, parseContext, errors);
     for (const auto& kw : deck) {
         std::stringstream ss;
@@ -33,6 +33,12 @@ inline void pack_deck( const char * deck_file, std::ostream& os) {
     Opm::ErrorGuard errors;
     Opm::Parser parser;
 
+    /*
+      The data of grid property keywords is written out as it was read,
+      without tokenizing it.
+    */
+    parser.deferDataKeywords(true);
+
     auto deck = parser.parseFile(deck_file, parseContext, errors);
     os << deck;
 
@@ -43,7 +49,9 @@ void print_help_and_exit() {
     const char * help_text = R"(
 The opmpack program will load a deck, resolve all include
 files and then print it out again on stdout. All comments
-will be stripped and the value types will be validated.
+will be stripped and the value types will be validated, except
+for the numeric data of grid property keywords like COORD,
+ZCORN and PERMX which is copied as it is.
 
 By passing the option -o you can redirect the output to a file
 or a directory.
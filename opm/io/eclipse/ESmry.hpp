@@ -19,10 +19,18 @@
 #ifndef OPM_IO_ESMRY_HPP
 #define OPM_IO_ESMRY_HPP
 
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 #include <boost/filesystem.hpp> 
 
+#include <opm/io/eclipse/EclFile.hpp>
+
 namespace Opm { namespace EclIO {
 
 class ESmry
@@ -36,8 +44,23 @@ public:
 
     bool hasKey(const std::string& key) const;
 
+    // Summary vectors are read from the result files on first access,
+    // loadData can be used to read several vectors in one pass. Loading is
+    // serialised internally, so the const member functions may be called
+    // concurrently from several threads.
+    void loadData() const;
+    void loadData(const std::vector<std::string>& vectList) const;
+
     const std::vector<float>& get(const std::string& name) const;
 
+    // Write transposed copy of summary data (one contiguous array pr vector)
+    // to file with extension LODSMRY. Subsequent ESmry objects read vectors
+    // from this file as long as size and modification time of the SMSPEC
+    // and result files are unchanged.
+    void make_lodsmry_file();
+
+    bool usesLodsmryFile() const { return lodFile != nullptr; }
+
     std::vector<float> get_at_rstep(const std::string& name) const;
 
     const std::vector<std::string>& keywordList() const { return keyword; }
@@ -48,8 +71,32 @@ private:
     int nVect, nI, nJ, nK;
 
     void ijk_from_global_index(int glob, int &i, int &j, int &k) const;
-    std::vector<std::vector<float>> param;
+    mutable std::vector<std::vector<float>> param;
+    mutable std::vector<bool> vectorLoaded;
+    std::unique_ptr<std::mutex> loadMutex = std::make_unique<std::mutex>();
     std::vector<std::string> keyword;
+    std::unordered_map<std::string, int> keyIndex;
+
+    // summary result files (unified or non-unified) of all runs
+    std::vector<std::unique_ptr<EclFile>> smryFiles;
+
+    // PARAMS array of each time step: run number, result file and array index in file
+    std::vector<std::tuple<int, int, int>> timeStepList;
+
+    // position of each summary vector in PARAMS arrays of each run, -1 if not in run
+    std::vector<std::vector<int>> paramsPos;
+
+    bool withBaseRunData;
+    boost::filesystem::path lodsmryFile;
+    std::unique_ptr<EclFile> lodFile;
+
+    std::vector<std::string> lodSourceFiles;
+
+    bool lodsmryFileUpToDate() const;
+
+    // Size and modification time (seconds and nanoseconds) of each of the
+    // lodSourceFiles, empty if any of them can not be examined.
+    std::vector<double> sourceFileStamps() const;
 
     std::vector<int> seqIndex;
     std::vector<float> seqTime;
@@ -63,6 +110,17 @@ private:
     void updatePathAndRootName(boost::filesystem::path& dir, boost::filesystem::path& rootN) const;
 
     std::string makeKeyString(const std::string& keyword, const std::string& wgname, int num) const;
+
+    int keywordIndex(const std::string& name) const;
+
+    // Load the vectors not yet loaded; caller must hold loadMutex.
+    void loadVectors(const std::vector<std::string>& vectList) const;
+
+    void readParams(std::fstream& fileH, int& openFile, int step,
+                    const std::vector<int>& elements, std::vector<float>& values) const;
+
+    void readTimeSteps(const std::vector<std::vector<int>>& runElements,
+                       const std::function<void(int, const std::vector<float>&)>& store) const;
 };
 
 }} // namespace Opm::EclIO
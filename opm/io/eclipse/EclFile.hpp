@@ -50,6 +50,7 @@ public:
       doub_array.clear();
       logi_array.clear();
       char_array.clear();
+      arrayLoaded.assign(arrayLoaded.size(), false);
     }
 
     using EclEntry = std::tuple<std::string, eclArrType, int>;
@@ -65,6 +66,28 @@ public:
 
     const std::vector<std::string>& arrayNames() const { return array_name; }
 
+    const std::string& fileName() const { return inputFilename; }
+
+    // Type, number of elements and stream position of the data of array
+    // arrIndex, for readers which fetch parts of an array directly.
+    eclArrType arrayType(int arrIndex) const { return array_type[arrIndex]; }
+    int arraySize(int arrIndex) const { return array_size[arrIndex]; }
+    std::streampos dataPosition(int arrIndex) const { return static_cast<std::streamoff>(ifStreamPos[arrIndex]); }
+
+    // Write index of all array headers to sidecar file indexFileName(). The
+    // index is used in place of scanning the file when opening it again, as
+    // long as size and modification time of the file are unchanged and the
+    // last indexed array header is still found at its recorded position.
+    void writeIndex() const;
+
+    // Bring the sidecar index of a file which has grown by appending arrays
+    // up to date. Entries of an existing index which still matches the
+    // leading part of the file are kept, and only the appended arrays are
+    // scanned.
+    static void updateIndex(const std::string& filename);
+
+    static std::string indexFileName(const std::string& filename);
+
 protected:
     bool formatted;
     std::string inputFilename;
@@ -108,7 +131,8 @@ private:
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, long int fromPos);
-    
+
+    bool loadIndex();
 };
 
 }} // namespace Opm::EclIO
@@ -18,6 +18,7 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <cstddef>
 #include <fstream>
 #include <ios>
 #include <string>
@@ -71,6 +72,11 @@ public:
         }
     }
 
+    // Write double precision data as a single precision (REAL) array.
+    // Values are narrowed while output, no temporary float copy is made.
+    void writeAsFloat(const std::string& name,
+                      const std::vector<double>& data);
+
     void message(const std::string& msg);
     void flushStream();
 
@@ -83,6 +89,12 @@ private:
     template <typename T>
     void writeBinaryArray(const std::vector<T>& data);
 
+    // Write size elements of type arrType as blocks of the binary format,
+    // fill(buffer, from, num) stores elements [from, from + num) on disk
+    // representation in buffer.
+    template <typename Fill>
+    void writeBinaryBlocks(eclArrType arrType, std::size_t size, Fill&& fill);
+
     void writeBinaryCharArray(const std::vector<std::string>& data);
     void writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data);
 
@@ -99,6 +111,9 @@ private:
 
     bool isFormatted;
     std::ofstream ofileH;
+
+    // Output buffer for one block of binary data, reused between arrays.
+    std::vector<char> blockBuffer;
 };
 
 
@@ -204,6 +204,16 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         void write(const std::string&         kw,
                    const std::vector<double>& data);
 
+        /// Write double precision floating point data to underlying
+        /// output stream as single precision values.  Avoids forming
+        /// a temporary single precision copy of the data.
+        ///
+        /// \param[in] kw Name of output vector (keyword).
+        ///
+        /// \param[in] data Output values.
+        void writeAsFloat(const std::string&         kw,
+                          const std::vector<double>& data);
+
         /// Write unpadded string data to underlying output stream.
         ///
         /// \param[in] kw Name of output vector (keyword).
@@ -225,6 +235,13 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// Restart output stream.
         std::unique_ptr<EclOutput> stream_;
 
+        /// Name of unified restart file.  Empty for separate files.
+        ///
+        /// Array header index of this file is updated (see
+        /// EclFile::updateIndex()) when the stream is closed.  Only the
+        /// arrays of the new report step are scanned.
+        std::string unifiedFile_{};
+
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
         ///
@@ -272,6 +289,10 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// Must not be called prior to \c prepareStep.
         EclOutput& stream();
 
+        /// Close output stream and update array header index of unified
+        /// restart file.  No-op for separate restart files.
+        void closeAndIndex();
+
         /// Implementation function for public \c write overload set.
         template <typename T>
         void writeImpl(const std::string&    kw,
@@ -434,6 +455,19 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                       const Formatted& fmt,
                       const Unified&   unif);
 
+    /// Write array header index (see EclFile::updateIndex()) of unified
+    /// summary file of particular result set.
+    ///
+    /// Intended to be called once the summary file's output stream has
+    /// been closed.  Errors are ignored since the index is an optional
+    /// acceleration structure for subsequent readers.
+    ///
+    /// \param[in] rset Output directory and base name of result set.
+    ///
+    /// \param[in] fmt Whether or not summary file is formatted.
+    void indexUnifiedSummaryFile(const ResultSet& rset,
+                                 const Formatted& fmt);
+
     /// Derive filename corresponding to output stream of particular result
     /// set, with user-specified file extension.
     ///
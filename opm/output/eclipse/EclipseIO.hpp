@@ -22,6 +22,7 @@
 #ifndef OPM_ECLIPSE_WRITER_HPP
 #define OPM_ECLIPSE_WRITER_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -181,6 +182,28 @@ public:
                         RestartValue value,
                         const bool write_double = false);
 
+    /*
+      Enable or disable asynchronous output of time steps. When enabled,
+      writeTimeStep() hands the summary, restart and RFT output over to a
+      dedicated writer thread and returns without waiting for the files
+      to be written. Time steps are written in the order of the calls. At
+      most max_pending time steps are queued; when the queue is full
+      writeTimeStep() blocks until the writer has caught up.
+
+      The writer uses the EclipseState, Schedule and SummaryConfig passed
+      to the constructor, and these must not be modified while output is
+      pending. An exception thrown by the writer is rethrown from the
+      next call to writeTimeStep() or flush(); output queued after the
+      failing time step is discarded.
+    */
+    void setAsyncOutput(bool async, std::size_t max_pending = 2);
+
+    /*
+      Wait until all output queued by writeTimeStep() has been written to
+      disk. Does nothing unless asynchronous output is enabled.
+    */
+    void flush();
+
 
     /*
       Will load solution data and wellstate from the restart
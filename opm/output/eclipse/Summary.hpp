@@ -56,6 +56,7 @@ public:
 
     void add_timestep(const SummaryState& st, const int report_step);
 
+    // Concurrent calls to eval() on the same object are serialised.
     void eval(SummaryState&                  summary_state,
               const int                      report_step,
               const double                   secs_elapsed,
@@ -68,6 +69,11 @@ public:
 
     void write() const;
 
+    // Evaluate the summary parameters of eval() using num_threads
+    // threads (default 1).  Requires OpenMP support, evaluation is
+    // serial otherwise.
+    void set_eval_threads(const int num_threads);
+
 private:
     class SummaryImplementation;
     std::unique_ptr<SummaryImplementation> pImpl_;
@@ -0,0 +1,73 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DECK_CACHE_HPP
+#define DECK_CACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+    class Deck;
+    class ParseContext;
+    class Parser;
+
+    /*
+      The DeckCache class keeps a binary copy of a parsed Deck in a cache
+      directory, so that parsing an unchanged case again only amounts to
+      reading the keywords, records and item data back from disk.
+
+      The cache file is named after the DATA file, and is only used when it
+      was written with an equivalent Parser and ParseContext, and the
+      content of the DATA file and of every file it included - including
+      the include files which could not be found - is unchanged.
+    */
+    class DeckCache {
+    public:
+        DeckCache(const std::string& directory, const std::string& dataFile);
+
+        const std::string& fileName() const;
+
+        /*
+          Will add the keywords from the cache file to the empty deck and
+          return true if the cache file is valid. If the cache file is
+          missing, stale or damaged false is returned, and the content of
+          the deck is unspecified.
+        */
+        bool load(const Parser& parser, const ParseContext& context, Deck& deck) const;
+
+        /*
+          Writes the deck to the cache file; inputFiles should be all the
+          files which were opened while parsing the deck. Failure to write
+          the cache file is reported as a warning and otherwise ignored.
+        */
+        void store(const Parser& parser, const ParseContext& context, const Deck& deck, const std::vector<std::string>& inputFiles) const;
+
+        static std::uint64_t hashFile(const std::string& filename, std::int64_t& size);
+
+    private:
+        std::string data_file;
+        std::string directory;
+        std::string file_name;
+    };
+}
+
+#endif
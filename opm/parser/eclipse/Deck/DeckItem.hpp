@@ -20,6 +20,9 @@
 #ifndef DECKITEM_HPP
 #define DECKITEM_HPP
 
+#include <atomic>
+#include <functional>
+#include <mutex>
 #include <string>
 #include <vector>
 #include <memory>
@@ -31,6 +34,7 @@
 
 namespace Opm {
     class DeckOutput;
+    class DeckCacheIO;
 
     class DeckItem {
     public:
@@ -87,6 +91,23 @@ namespace Opm {
 
         type_tag getType() const;
 
+        /*
+          The parser can leave the values of an item as text, and install a
+          loader which is called to push_back() the values the first time
+          the item is accessed. Returns false until the loader has run.
+
+          The const members can be called concurrently also before the item
+          is loaded; the first access runs the loader under a lock. Copying
+          an item which is not yet loaded must not race with that access.
+
+          The optional text is the input the loader tokenizes; write() emits
+          it as it is while the item is not loaded, such that a deck can be
+          written out without tokenizing its deferred items.
+        */
+        using Loader = std::function< void( DeckItem& ) >;
+        void setLoader( Loader item_loader, std::shared_ptr< const std::string > text = nullptr );
+        bool loaded() const;
+
         void write(DeckOutput& writer) const;
         friend std::ostream& operator<<(std::ostream& os, const DeckItem& item);
 
@@ -111,6 +132,8 @@ namespace Opm {
         bool operator!=(const DeckItem& other) const;
         static bool to_bool(std::string string_value);
     private:
+        friend class DeckCacheIO;
+
         mutable std::vector< double > dval;
         std::vector< int > ival;
         std::vector< std::string > sval;
@@ -129,6 +152,23 @@ namespace Opm {
         std::vector< Dimension > active_dimensions;
         std::vector< Dimension > default_dimensions;
 
+        class DeferredLoader {
+        public:
+            DeferredLoader() = default;
+            DeferredLoader( const DeferredLoader& other );
+            DeferredLoader& operator=( const DeferredLoader& other );
+            DeferredLoader( DeferredLoader&& other ) noexcept;
+            DeferredLoader& operator=( DeferredLoader&& other ) noexcept;
+
+            Loader function;
+            std::shared_ptr< const std::string > text;
+            std::atomic< bool > pending{ false };
+            std::mutex mutex;
+        };
+
+        mutable DeferredLoader loader;
+        void load() const;
+
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
         template< typename T > void push( T );
@@ -32,6 +32,7 @@
 
 namespace Opm {
     class DeckOutput;
+    class DeckCacheIO;
     class ParserKeyword;
 
     class DeckKeyword {
@@ -86,6 +87,8 @@ namespace Opm {
 
         friend std::ostream& operator<<(std::ostream& os, const DeckKeyword& keyword);
     private:
+        friend class DeckCacheIO;
+
         std::string m_keywordName;
         Location m_location;
 
@@ -41,6 +41,7 @@ namespace Opm {
 
         void endl();
         void write_string(const std::string& s);
+        void write_raw(const std::string& text);  // Whitespace separated tokens, written unchanged.
         template <typename T> void write(const T& value);
 
         std::string item_sep = " ";        // Separator between items on a row.
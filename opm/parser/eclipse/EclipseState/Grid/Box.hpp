@@ -44,6 +44,24 @@ namespace Opm {
         const std::vector<size_t>& getIndexList() const;
         bool equal(const Box& other) const;
 
+        /*
+          Will call f(g) with the global index g of every cell in the box, in
+          the same order as the elements of getIndexList(), by running
+          strided loops over the box instead of materialising the index list.
+        */
+        template <typename F>
+        void forEachIndex(F f) const {
+            for (std::size_t k = 0; k < m_dims[2]; k++) {
+                for (std::size_t j = 0; j < m_dims[1]; j++) {
+                    const std::size_t offset = m_offset[0]
+                                             + (j + m_offset[1]) * m_stride[1]
+                                             + (k + m_offset[2]) * m_stride[2];
+                    for (std::size_t i = 0; i < m_dims[0]; i++)
+                        f(offset + i);
+                }
+            }
+        }
+
 
         int I1() const;
         int I2() const;
@@ -53,15 +71,21 @@ namespace Opm {
         int K2() const;
 
     private:
-        void initIndexList();
+        void initIndexList() const;
         const EclipseGrid& grid;
         size_t m_dims[3] = { 0, 0, 0 };
         size_t m_offset[3];
         size_t m_stride[3];
 
         bool   m_isGlobal;
-        std::vector<size_t> global_index_list;
-        std::vector<cell_index> m_index_list;
+
+        /*
+          The index lists are only built when asked for; the box operations
+          in GridProperty iterate with forEachIndex() instead.
+        */
+        mutable bool m_indexListValid = false;
+        mutable std::vector<size_t> global_index_list;
+        mutable std::vector<cell_index> m_index_list;
 
         int lower(int dim) const;
         int upper(int dim) const;
@@ -31,7 +31,9 @@
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace Opm {
@@ -150,8 +152,8 @@ namespace Opm {
         /// Will return a vector a length num_active; where the value
         /// of each element is the corresponding global index.
         const std::vector<int>& getActiveMap() const;
-        const std::array<double, 3>& getCellCenter(size_t i,size_t j, size_t k) const;
-        const std::array<double, 3>& getCellCenter(size_t globalIndex) const;
+        std::array<double, 3> getCellCenter(size_t i,size_t j, size_t k) const;
+        std::array<double, 3> getCellCenter(size_t globalIndex) const;
         std::array<double, 3> getCornerPos(size_t i,size_t j, size_t k, size_t corner_index) const;
         double getCellVolume(size_t globalIndex) const;
         double getCellVolume(size_t i , size_t j , size_t k) const;
@@ -188,7 +190,42 @@ namespace Opm {
 
         bool equal(const EclipseGrid& other) const;
 
+        /*
+          The cell volumes, centers, dimensions and depths are calculated
+          in blocks of cells when they are first asked for. The
+          precomputeGeometry() method will calculate the geometry for all
+          cells up front, using the given number of threads; with
+          threads <= 0 the OpenMP default is used. Code which visits the
+          whole grid should call it first; once all the geometry is
+          calculated a query only checks one flag.
+        */
+        void precomputeGeometry(int threads = 0) const;
+
     private:
+        struct GeometryCache {
+            GeometryCache() = default;
+            GeometryCache(const GeometryCache& other);
+            GeometryCache& operator=(const GeometryCache& other);
+
+            std::size_t rows_per_block = 0;
+            std::size_t num_blocks = 0;
+            std::size_t num_computed = 0;
+            std::atomic<bool> allocated{ false };
+            std::atomic<bool> complete{ false };
+            std::unique_ptr<std::atomic<bool>[]> computed;
+            mutable std::mutex mutex;
+
+            // One value per cell in the cartesian grid.
+            std::vector<double> volume;
+            std::vector<double> depth;
+            std::vector<double> dx;
+            std::vector<double> dy;
+            std::vector<double> dz;
+            std::vector<double> centerX;
+            std::vector<double> centerY;
+            std::vector<double> centerZ;
+        };
+
         std::vector<double> m_minpvVector;
         MinpvMode::ModeEnum m_minpvMode;
         Value<double> m_pinch;
@@ -213,13 +250,8 @@ namespace Opm {
         std::vector<int> m_active_to_global;
         std::vector<int> m_global_to_active;
 
-        // Geometry data.
-        std::vector<double> m_volume;
-        std::vector<double> m_depth;
-        std::vector<double> m_dx;
-        std::vector<double> m_dy;
-        std::vector<double> m_dz;
-        std::vector<std::array<double, 3>> m_cellCenter;
+        // Geometry data, calculated on demand.
+        mutable GeometryCache m_geometry;
 
         void initGridFromEGridFile(Opm::EclIO::EclFile& egridfile, std::string fileName);
 
@@ -260,7 +292,11 @@ namespace Opm {
         double sumJdir(int i, int k, int j1, const std::array<int, 3>& dims, const std::vector<double>& dy) const;
         double sumKdir(int i, int j, const std::array<int, 3>& dims, const std::vector<double>& dz) const;
 
-        void calculateGeometryData();
+        void resetGeometry();
+        void allocateGeometry() const;
+        const GeometryCache& geometry(std::size_t globalIndex) const;
+        void calculateBlockGeometry(std::size_t block) const;
+        void calculateRowGeometry(std::size_t j, std::size_t k) const;
 
         void getCellCorners(const std::array<int, 3>& ijk, const std::array<int, 3>& dims, std::array<double,8>& X, std::array<double,8>& Y, std::array<double,8>& Z) const;
    };
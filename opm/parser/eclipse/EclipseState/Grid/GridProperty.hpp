@@ -21,6 +21,7 @@
 
 #include <functional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -164,6 +165,27 @@ public:
     void maskedCopy( const GridProperty< T >& other, const std::vector< bool >& mask );
     void initMask( T value, std::vector<bool>& mask ) const;
 
+    /*
+      The masked operations can also be applied to a list of global
+      indices, typically from regionIndex(). For maskedOperate() the
+      property value is set to func( value , parameter value ).
+    */
+    void maskedSet( T value, const std::vector< size_t >& index_list );
+    void maskedMultiply( T value, const std::vector< size_t >& index_list );
+    void maskedAdd( T value, const std::vector< size_t >& index_list );
+    void maskedCopy( const GridProperty< T >& other, const std::vector< size_t >& index_list );
+    void maskedOperate( const std::function< double(double, double) >& func,
+                        const GridProperty< T >& parameter,
+                        const std::vector< size_t >& index_list );
+
+    /*
+      Will return the global indices of the cells where the property value
+      equals the input value. The indices for all values are built in one
+      pass over the property on the first call, and kept until the property
+      is modified.
+    */
+    const std::vector< size_t >& regionIndex( T value ) const;
+
     /**
        Due to the convention where it is only necessary to supply the
        top layer of the petrophysical properties we can unfortunately
@@ -181,6 +203,14 @@ public:
     void add( T shiftValue, const Box& );
     void setScalar( T value, const Box& );
 
+    /*
+      Sets the property value to func( value , parameter value ) for the
+      cells in the box, in place; this is the OPERATE keyword.
+    */
+    void operate( const std::function< double(double, double) >& func,
+                  const GridProperty< T >& parameter,
+                  const Box& );
+
     const std::string& getKeywordName() const;
     const SupportedKeywordInfo& getKeywordInfo() const;
 
@@ -309,6 +339,7 @@ private:
     void setElement(const typename std::vector<T>::size_type i,
                     const T                                  value,
                     const bool                               defaulted = false);
+    void clearRegionIndex();
 
     size_t m_nx, m_ny, m_nz;
     SupportedKeywordInfo m_kwInfo;
@@ -316,6 +347,9 @@ private:
     std::vector<bool> m_defaulted;
     bool m_hasRunPostProcessor = false;
     bool assigned = false;
+
+    mutable std::unordered_map< T, std::vector< size_t > > m_regionIndex;
+    mutable bool m_regionIndexValid = false;
 };
 
 // initialize the TEMPI grid property using the temperature vs depth
@@ -62,6 +62,12 @@ namespace Opm {
     typedef std::map< std::pair<int , int> , const MULTREGTRecord * >  MULTREGTSearchMap;
     typedef std::tuple<size_t , FaceDir::DirEnum , double> MULTREGTConnection;
 
+    struct MULTREGTFace {
+        size_t global_index1;
+        size_t global_index2;
+        FaceDir::DirEnum face_dir;
+    };
+
 
 
     class MULTREGTScanner {
@@ -71,12 +77,38 @@ namespace Opm {
                         const std::vector< const DeckKeyword* >& keywords);
         double getRegionMultiplier(size_t globalCellIdx1, size_t globalCellIdx2, FaceDir::DirEnum faceDir) const;
 
+        /*
+          Will assign the region multiplier of every face in the list to
+          the corresponding element of multipliers; this is equivalent to
+          calling getRegionMultiplier() for each face.
+        */
+        void getRegionMultipliers(const std::vector< MULTREGTFace >& faces, std::vector< double >& multipliers) const;
+
     private:
+        /*
+          The search map for one region keyword compiled to a lookup
+          table: when the region values span a small enough range the
+          (region1, region2) pairs are stored in a dense matrix of record
+          indices, otherwise as a sorted list of pairs. The region data is
+          resolved once when the scanner is created.
+        */
+        struct SearchTable {
+            const std::vector< int >* region_data;
+            int min_region;
+            int num_regions;
+            std::vector< int > dense;
+            std::vector< std::pair< std::pair< int , int > , int > > sparse;
+
+            int find(int region1, int region2) const;
+        };
+
         void addKeyword( const Eclipse3DProperties& props, const DeckKeyword& deckKeyword, const std::string& defaultRegion);
         void assertKeywordSupported(const DeckKeyword& deckKeyword, const std::string& defaultRegion);
+        void addSearchTable( const Eclipse3DProperties& props, const std::string& region_name, const MULTREGTSearchMap& searchMap);
         std::vector< MULTREGTRecord > m_records;
-        std::map<std::string , MULTREGTSearchMap> m_searchMap;
-        const Eclipse3DProperties& m_e3DProps;
+        std::vector< SearchTable > m_searchTables;
+        size_t m_nx = 0;
+        size_t m_ny = 0;
     };
 
 }
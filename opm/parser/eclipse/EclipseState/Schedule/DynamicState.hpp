@@ -24,6 +24,8 @@
 #include <stdexcept>
 #include <vector>
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <utility>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/TimeMap.hpp>
@@ -50,6 +52,13 @@ namespace Opm {
        The update() method returns true if the updated value is
        different from the current value, this implies that the
        class<T> must support operator!=
+
+       The values are stored as a sorted list of change points, i.e. pairs
+       (first_step, value) where value applies from first_step until the
+       next change point. The storage is therefore proportional to the
+       number of changes and not the number of report steps; get() is a
+       binary search among the change points and an update() at or after
+       the last change point is amortized constant time.
     */
 
 
@@ -58,23 +67,84 @@ template< class T >
 class DynamicState {
 
     public:
-        typedef typename std::vector< T >::iterator iterator;
+        /*
+          Iteration visits the stored values, i.e. the value of each change
+          point, and not the value of every report step. Modifying the values
+          through the iterator is therefore equivalent to modifying the value
+          of all the report steps.
+        */
+        template <typename Iter, typename Value>
+        class value_iterator {
+        public:
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+            using iterator_category = std::forward_iterator_tag;
+
+            explicit value_iterator(Iter iter_arg) :
+                iter(iter_arg)
+            {}
+
+            reference operator*() const {
+                return this->iter->second;
+            }
+
+            pointer operator->() const {
+                return std::addressof(this->iter->second);
+            }
+
+            value_iterator& operator++() {
+                ++this->iter;
+                return *this;
+            }
+
+            value_iterator operator++(int) {
+                auto copy = *this;
+                ++this->iter;
+                return copy;
+            }
+
+            bool operator==(const value_iterator& other) const {
+                return this->iter == other.iter;
+            }
+
+            bool operator!=(const value_iterator& other) const {
+                return this->iter != other.iter;
+            }
+
+        private:
+            Iter iter;
+        };
+
+        typedef value_iterator<typename std::vector<std::pair<std::size_t, T>>::iterator, T> iterator;
+        typedef value_iterator<typename std::vector<std::pair<std::size_t, T>>::const_iterator, const T> const_iterator;
 
         DynamicState( const TimeMap& timeMap, T initial ) :
-            m_data( timeMap.size(), initial ),
+            m_size( timeMap.size() ),
             initial_range( timeMap.size() )
-        {}
+        {
+            if (this->m_size > 0)
+                this->m_data.emplace_back(0, std::move(initial));
+        }
 
         void globalReset( T value ) {
-            this->m_data.assign( this->m_data.size(), value );
+            if (this->m_size == 0)
+                return;
+
+            this->m_data.clear();
+            this->m_data.emplace_back(0, std::move(value));
         }
 
         const T& back() const {
-            return m_data.back();
+            return m_data.back().second;
         }
 
         const T& at( size_t index ) const {
-            return this->m_data.at( index );
+            if (index >= this->m_size)
+                throw std::out_of_range("Invalid index for DynamicState");
+
+            return this->m_data[this->point_index(index)].second;
         }
 
         const T& operator[](size_t index) const {
@@ -86,26 +156,15 @@ class DynamicState {
         }
 
         void updateInitial( T initial ) {
-            std::fill_n( this->m_data.begin(), this->initial_range, initial );
+            this->assign( 0, std::min(this->initial_range, this->m_size), std::move(initial) );
         }
 
 
         std::vector<std::pair<std::size_t, T>> unique() const {
-            if (this->m_data.empty())
-                return {};
-
-            const auto * current_value = std::addressof(this->m_data[0]);
-            std::size_t current_index = 0;
-            std::vector<std::pair<std::size_t, T>> result{{current_index, *current_value}};
-            while (true) {
-                if (this->m_data[current_index] != *current_value) {
-                    current_value = std::addressof(this->m_data[current_index]);
-                    result.emplace_back(current_index, *current_value);
-                }
-
-                current_index++;
-                if (current_index == this->m_data.size())
-                    break;
+            std::vector<std::pair<std::size_t, T>> result;
+            for (const auto& point : this->m_data) {
+                if (result.empty() || result.back().second != point.second)
+                    result.push_back(point);
             }
 
             return result;
@@ -117,25 +176,22 @@ class DynamicState {
            return true, otherwise it will return false.
         */
         bool update( size_t index, T value ) {
-            if( this->initial_range == this->m_data.size() )
+            if( this->initial_range == this->m_size )
                 this->initial_range = index;
 
-            const bool change = (value != this->m_data.at( index ));
+            const bool change = (value != this->at( index ));
 
             if( !change ) return false;
 
-            std::fill( this->m_data.begin() + index,
-                       this->m_data.end(),
-                       value );
-
+            this->assign( index, this->m_size, std::move(value) );
             return true;
         }
 
         void update_elm( size_t index, const T& value ) {
-            if (this->m_data.size() <= index)
+            if (this->m_size <= index)
                 throw std::out_of_range("Invalid index for update_elm()");
 
-            this->m_data[index] = value;
+            this->assign( index, index + 1, value );
         }
 
 
@@ -147,69 +203,108 @@ class DynamicState {
       applied for all times in the range [Tx,T2].
     */
     void update_equal(size_t index, const T& value) {
-        if (this->m_data.size() <= index)
+        if (this->m_size <= index)
             throw std::out_of_range("Invalid index for update_equal()");
 
-        const T prev_value = this->m_data[index];
+        const T prev_value = this->at(index);
         if (prev_value == value)
             return;
 
-        while (true) {
-            if (this->m_data[index] != prev_value)
-                break;
+        auto next_point = this->point_index(index) + 1;
+        while (next_point < this->m_data.size() && this->m_data[next_point].second == prev_value)
+            next_point++;
 
-            this->m_data[index] = value;
-
-            index++;
-            if (index == this->m_data.size())
-                break;
-
-        }
+        const auto end_index = (next_point < this->m_data.size()) ? this->m_data[next_point].first : this->m_size;
+        this->assign( index, end_index, value );
     }
 
     /// Will return the index of the first occurence of @value, or
     /// -1 if @value is not found.
     int find(const T& value) const {
-        auto iter = std::find( m_data.begin() , m_data.end() , value);
-        if( iter == this->m_data.end() ) return -1;
-
-        return std::distance( m_data.begin() , iter );
+        return this->find_if([&value] (const T& elm) { return elm == value; });
     }
 
     template<typename P>
     int find_if(P&& pred) const {
-        auto iter = std::find_if(m_data.begin(), m_data.end(), std::forward<P>(pred));
-        if( iter == this->m_data.end() ) return -1;
+        for (const auto& point : this->m_data) {
+            if (pred(point.second))
+                return point.first;
+        }
 
-        return std::distance( m_data.begin() , iter );
+        return -1;
     }
 
     /// Will return the index of the first value which is != @value, or -1
     /// if all values are == @value
     int find_not(const T& value) const {
-        auto iter = std::find_if_not( m_data.begin() , m_data.end() , [&value] (const T& elm) { return value == elm; });
-        if( iter == this->m_data.end() ) return -1;
-
-        return std::distance( m_data.begin() , iter );
+        return this->find_if([&value] (const T& elm) { return !(value == elm); });
     }
 
     iterator begin() {
-        return this->m_data.begin();
+        return iterator(this->m_data.begin());
     }
 
 
     iterator end() {
-        return this->m_data.end();
+        return iterator(this->m_data.end());
+    }
+
+
+    const_iterator begin() const {
+        return const_iterator(this->m_data.begin());
+    }
+
+
+    const_iterator end() const {
+        return const_iterator(this->m_data.end());
     }
 
 
     std::size_t size() const {
-        return this->m_data.size();
+        return this->m_size;
     }
 
     private:
-        std::vector< T > m_data;
+        // Change points sorted on first_step; the first change point is
+        // always at step zero.
+        std::vector< std::pair<std::size_t, T> > m_data;
+        std::size_t m_size;
         size_t initial_range;
+
+        // Index of the change point which applies at step index.
+        std::size_t point_index(std::size_t index) const {
+            auto iter = std::upper_bound(this->m_data.begin(), this->m_data.end(), index,
+                                         [](std::size_t step, const std::pair<std::size_t, T>& point) { return step < point.first; });
+            if (iter == this->m_data.begin())
+                return 0;
+
+            return std::distance(this->m_data.begin(), iter) - 1;
+        }
+
+        // Sets the value for all steps in the range [begin_index, end_index).
+        void assign(std::size_t begin_index, std::size_t end_index, T value) {
+            if (begin_index >= end_index)
+                return;
+
+            const auto step_less = [](const std::pair<std::size_t, T>& point, std::size_t step) { return point.first < step; };
+            const std::size_t first_point = std::distance(this->m_data.begin(), std::lower_bound(this->m_data.begin(), this->m_data.end(), begin_index, step_less));
+            std::size_t last_point = std::distance(this->m_data.begin(), std::lower_bound(this->m_data.begin() + first_point, this->m_data.end(), end_index, step_less));
+
+            // The value which applied at end_index must continue to apply
+            // from end_index.
+            if (end_index < this->m_size && (last_point == this->m_data.size() || this->m_data[last_point].first != end_index)) {
+                if (last_point > first_point) {
+                    last_point--;
+                    this->m_data[last_point].first = end_index;
+                } else {
+                    T tail_value = this->m_data[last_point - 1].second;
+                    this->m_data.emplace(this->m_data.begin() + last_point, end_index, std::move(tail_value));
+                }
+            }
+
+            this->m_data.erase(this->m_data.begin() + first_point, this->m_data.begin() + last_point);
+            this->m_data.emplace(this->m_data.begin() + first_point, begin_index, std::move(value));
+        }
 };
 
 }
@@ -21,6 +21,8 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 
@@ -33,6 +35,7 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/Group/GuideRateConfig.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Tuning.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 #include <opm/parser/eclipse/EclipseState/Util/OrderedMap.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/MessageLimits.hpp>
 #include <opm/parser/eclipse/EclipseState/Runspec.hpp>
@@ -174,8 +177,17 @@ namespace Opm
         std::vector<Well2> getWells2(size_t timeStep) const;
         std::vector<Well2> getWells2atEnd() const;
 
+        /*
+          The *Ptr variants return pointers to the Well2 objects owned by the
+          Schedule instead of copies. The pointers are valid until the
+          Schedule is modified, e.g. with updateWell() or applyAction().
+        */
+        std::vector<const Well2*> getWells2Ptr(size_t timeStep) const;
+        std::vector<const Well2*> getWells2atEndPtr() const;
+
         std::vector<const Group2*> getChildGroups2(const std::string& group_name, size_t timeStep) const;
         std::vector<Well2> getChildWells2(const std::string& group_name, size_t timeStep) const;
+        const std::vector<const Well2*>& getChildWells2Ptr(const std::string& group_name, size_t timeStep) const;
         const OilVaporizationProperties& getOilVaporizationProperties(size_t timestep) const;
 
         const UDQActive& udqActive(size_t timeStep) const;
@@ -217,10 +229,20 @@ namespace Opm
 
         void applyAction(size_t reportStep, const Action::ActionX& action, const Action::Result& result);
         int getNupcol(size_t reportStep) const;
+
+        /*
+          Incremented whenever a well or group is added to or replaced in the
+          Schedule. Callers which keep Well2 pointers or values derived from
+          the wells across calls compare it to detect that they are stale.
+        */
+        std::size_t modificationCount() const;
     private:
         TimeMap m_timeMap;
         OrderedMap< std::string, DynamicState<std::shared_ptr<Well2>>> wells_static;
         OrderedMap< std::string, DynamicState<std::shared_ptr<Group2>>> groups;
+        // Index of the names in wells_static and groups for pattern matching.
+        NameIndex well_index;
+        NameIndex group_index;
         DynamicState< OilVaporizationProperties > m_oilvaporizationproperties;
         Events m_events;
         DynamicVector< Deck > m_modifierDeck;
@@ -242,7 +264,36 @@ namespace Opm
 
         std::map<std::string,Events> well_events;
 
+        // The wells of each group, including wells in subgroups, flattened
+        // on demand by getChildWells2Ptr(). Consecutive report steps with
+        // the same wells share one list, such that the cache holds one
+        // list per group and change of its wells rather than one per
+        // report step. The cache is filled under the mutex, such that
+        // getChildWells2Ptr() can be called concurrently like the other
+        // const members; it is cleared whenever a well or group is
+        // updated. A copy of the Schedule starts out with an empty cache.
+        struct ChildWellsCache {
+            ChildWellsCache() = default;
+            ChildWellsCache(const ChildWellsCache&) {}
+            ChildWellsCache& operator=(const ChildWellsCache&) { this->wells.clear(); return *this; }
+
+            // Wells of report steps [first_step, last_step], keyed on first_step.
+            struct Range {
+                std::size_t last_step;
+                std::unique_ptr<const std::vector<const Well2*>> wells;
+            };
+
+            std::mutex mutex;
+            std::unordered_map<std::string, std::map<std::size_t, Range>> wells;
+        };
+
+        mutable ChildWellsCache child_wells_cache;
+        std::size_t m_modification_count = 0;
+
+        void wellsModified();
+
         GTNode groupTree(const std::string& root_node, std::size_t report_step, const GTNode * parent) const;
+        const std::vector<const Well2*>& childWells(const std::string& group_name, size_t timeStep) const;
         void updateGroup(std::shared_ptr<Group2> group, size_t reportStep);
         bool checkGroups(const ParseContext& parseContext, ErrorGuard& errors);
         void updateUDQActive( std::size_t timeStep, std::shared_ptr<UDQActive> udq );
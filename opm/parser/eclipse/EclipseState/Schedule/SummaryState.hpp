@@ -25,7 +25,11 @@
 #include <vector>
 #include <unordered_map>
 #include <unordered_set>
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
+#include <iterator>
+#include <utility>
 
 namespace Opm{
 
@@ -64,7 +68,33 @@ namespace Opm{
 
 class SummaryState {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    /*
+      Iteration visits the keys which have a value, as (key, value) pairs.
+    */
+    class const_iterator {
+    public:
+        using value_type = std::pair<std::string, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+        using iterator_category = std::forward_iterator_tag;
+
+        const_iterator(const SummaryState& st, std::size_t slot);
+
+        reference operator*() const;
+        pointer operator->() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const;
+        bool operator!=(const const_iterator& other) const;
+
+    private:
+        const SummaryState* st;
+        std::size_t slot;
+
+        void skip_empty();
+    };
+
     explicit SummaryState(std::chrono::system_clock::time_point sim_start_arg);
 
     /*
@@ -87,28 +117,117 @@ public:
     double get_well_var(const std::string& well, const std::string& var) const;
     double get_group_var(const std::string& group, const std::string& var) const;
 
+    /*
+      All keys are interned into dense integer slots, the value of a key is
+      stored in a flat array at the slot index. The slot of a key can be
+      retrieved once as a handle, and the handle then used to access the value
+      without any string hashing or concatenation. A handle is valid for the
+      lifetime of the SummaryState object, also across deserialize().
+
+      Getting a handle does not give the key a value; has_value() is false
+      until the key is updated. Updating a well or group variable through its
+      handle is equivalent to update_well_var() and update_group_var().
+    */
+    std::size_t handle(const std::string& key);
+    std::size_t well_var_handle(const std::string& well, const std::string& var);
+    std::size_t group_var_handle(const std::string& group, const std::string& var);
+
+    bool has_value(std::size_t handle) const;
+    double get_value(std::size_t handle) const;
+    void update_value(std::size_t handle, double value);
+
+    /*
+      Handles can be kept by code which sees several SummaryState objects by
+      remembering the instance_id() they were retrieved from. Every object
+      has its own id and a copy gets a new id, because the slots of the copy
+      and the original can be assigned to different keys from then on.
+    */
+    std::uint64_t instance_id() const;
+
     std::vector<std::string> wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     std::vector<std::string> groups() const;
     std::vector<std::string> groups(const std::string& var) const;
+
+    /*
+      The serialized buffer starts with the key dictionary, i.e. the keys of
+      all the slots, followed by the values. When the state is sent
+      repeatedly to the same receiver the receiver already knows most of the
+      keys: serialize_delta(known_keys) only includes the keys of the slots
+      following the first known_keys slots, where known_keys is the
+      num_keys() value of the sender when the previous buffer was created.
+
+      deserialize() accepts both kinds of buffers and makes the receiver an
+      exact copy of the sender; a delta buffer must follow a buffer from the
+      same sender, otherwise std::invalid_argument is thrown.
+
+          // Sender                             // Receiver
+          auto buffer = st.serialize();         st.deserialize(buffer);
+          auto known = st.num_keys();
+          ...
+          buffer = st.serialize_delta(known);   st.deserialize(buffer);
+          known = st.num_keys();
+    */
     std::vector<char> serialize() const;
+    std::vector<char> serialize_delta(std::size_t known_keys) const;
     void deserialize(const std::vector<char>& buffer);
     const_iterator begin() const;
     const_iterator end() const;
     std::size_t num_wells() const;
+    std::size_t num_keys() const;
     std::size_t size() const;
 private:
+    enum class SlotType : char { Plain, Well, Group };
+
+    class InstanceId {
+    public:
+        InstanceId();
+        InstanceId(const InstanceId&);
+        InstanceId& operator=(const InstanceId&);
+
+        std::uint64_t value;
+    };
+
+    InstanceId m_instance_id;
     std::chrono::system_clock::time_point sim_start;
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    // Interned keys. Slot i holds the (key, value) pair entries[i], where
+    // the value is only valid if has_values[i] is set. Slots are never
+    // removed.
+    std::unordered_map<std::string, std::size_t> key_index;
+    std::vector<std::pair<std::string, double>> entries;
+
+    // The value seen by get_well_var() and get_group_var() for a registered
+    // slot; it is only updated by the well and group updates, whereas the
+    // general value is also updated by update() and set() of the same key.
+    std::vector<double> entity_values;
+    std::vector<char> has_values;
+    std::vector<char> is_totals;
+    std::vector<SlotType> slot_types;
+    std::vector<char> registered;
+    std::size_t num_values = 0;
+
+    // The first key is the variable and the second key is the well, the
+    // value is the slot index.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> well_values;
     std::unordered_set<std::string> m_wells;
 
     // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
+    std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>> group_values;
     std::unordered_set<std::string> m_groups;
+
+    // The local slot of each slot in the SummaryState which created the last
+    // deserialized buffer.
+    std::vector<std::size_t> remote_slots;
+
+    std::size_t intern(const std::string& key, SlotType type);
+    std::size_t entity_var_handle(const std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& entity_slots,
+                                  const std::string& entity, const std::string& var, SlotType type);
+    void assign(std::size_t slot, double value);
+    void accumulate(std::size_t slot, double value);
+    void register_slot(std::size_t slot);
+    void rebuild_registered(const std::vector<char>& new_registered);
 };
 
 
@@ -21,9 +21,11 @@
 #ifndef TIMEMAP_HPP_
 #define TIMEMAP_HPP_
 
+#include <cstdint>
 #include <vector>
 #include <ctime>
 #include <map>
+#include <string>
 
 #include <stddef.h>
 
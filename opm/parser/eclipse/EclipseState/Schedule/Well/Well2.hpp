@@ -385,6 +385,9 @@ public:
      */
     double production_rate( const SummaryState& st, Phase phase) const;
     double injection_rate( const SummaryState& st,  Phase phase) const;
+
+    // Compiles the pattern for every call, use NamePattern directly to
+    // match one pattern against many well names.
     static bool wellNameInWellNamePattern(const std::string& wellName, const std::string& wellNamePattern);
 
     /*
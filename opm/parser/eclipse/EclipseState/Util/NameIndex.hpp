@@ -0,0 +1,86 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_NAME_INDEX_HPP
+#define OPM_NAME_INDEX_HPP
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+/*
+  A well or group name pattern like 'OP*' or 'P?_1', with the same semantics
+  as fnmatch() without flags. The pattern is analyzed once on construction,
+  the literal prefix before the first special character is extracted and
+  patterns which only use '*' and '?' are matched without calling fnmatch().
+*/
+
+class NamePattern {
+public:
+    explicit NamePattern(const std::string& pattern);
+
+    bool match(const std::string& name) const;
+
+    // True if the pattern contains any of the special characters '*', '?',
+    // '[' or '\'; otherwise the pattern only matches itself.
+    bool wildcard() const;
+    const std::string& prefix() const;
+    const std::string& pattern() const;
+
+private:
+    std::string m_pattern;
+    std::string m_prefix;
+    bool m_wildcard;
+    bool prefix_only;
+    bool use_fnmatch;
+
+    bool glob_match(const std::string& name) const;
+};
+
+
+/*
+  Index of well or group names to find the names matching a pattern without
+  testing every name. The names are kept sorted, so only the names starting
+  with the literal prefix of the pattern are tested - for the common pattern
+  'PREFIX*' no further matching is needed at all.
+
+  The names are identified by the order in which they were added; the
+  result of match() is in that order.
+*/
+
+class NameIndex {
+public:
+    // Adds a new name, and returns the index of the name.
+    std::size_t add(const std::string& name);
+    bool has(const std::string& name) const;
+    std::size_t size() const;
+
+    std::vector<std::size_t> match(const std::string& pattern) const;
+    std::vector<std::size_t> match(const NamePattern& pattern) const;
+
+private:
+    std::map<std::string, std::size_t> sorted_names;
+};
+
+}
+
+#endif
@@ -20,10 +20,12 @@
 #ifndef OPM_PARSER_HPP
 #define OPM_PARSER_HPP
 
+#include <array>
 #include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <list>
 #include <boost/filesystem.hpp>
@@ -50,6 +52,9 @@ namespace Opm {
     class Parser {
     public:
         explicit Parser(bool addDefault = true);
+        Parser(Parser&&);
+        Parser& operator=(Parser&&);
+        ~Parser();
 
         static std::string stripComments(const std::string& inputString);
 
@@ -103,6 +108,22 @@ namespace Opm {
             addParserKeyword( T() );
         }
 
+        /*!
+         * \brief Register a keyword which is only created, by calling
+         * factory, the first time one of its deck names is looked up.
+         *
+         * This is used for the generated default keywords, so that a Parser
+         * does not instantiate all the keywords the deck does not use.
+         * Keywords with a deck name regular expression or code keywords
+         * must be added with addParserKeyword().
+         */
+        void addLazyKeyword(const std::vector<std::string>& deckNames, ParserKeyword (*factory)());
+
+        template <class T>
+        void addLazyKeyword(const std::vector<std::string>& deckNames) {
+            addLazyKeyword( deckNames, &Parser::createKeyword<T> );
+        }
+
         static EclipseState parse(const Deck& deck,            const ParseContext& context, ErrorGuard& errors);
         static EclipseState parse(const std::string &filename, const ParseContext& context, ErrorGuard& errors);
         static EclipseState parseData(const std::string &data, const ParseContext& context, ErrorGuard& errors);
@@ -130,22 +151,82 @@ namespace Opm {
 
         const std::vector<std::pair<std::string,std::string>> codeKeywords() const;
 
+        /*!
+         * \brief Keep the data of integer and floating point data keywords,
+         * like COORD, ZCORN and PERMX, as text while parsing, and tokenize it
+         * when the values are first accessed.
+         *
+         * Malformed data in such keywords is then reported when the values
+         * are accessed, and not by parseFile().
+         */
+        void deferDataKeywords(bool defer);
+        bool deferredDataKeywords() const;
+
+        /*!
+         * \brief Store a binary copy of the decks parsed with parseFile() in
+         * the given directory, and load the deck from there when the DATA
+         * file and all its include files are unchanged.
+         *
+         * Decks which gave errors are not stored, and warnings from the
+         * original parse are not repeated when a deck is loaded from the
+         * cache. An empty directory, which is the default, disables the cache.
+         */
+        void setDeckCacheDirectory(const std::string& directory);
+        const std::string& deckCacheDirectory() const;
+
+        /*!
+         * \brief Identifies the definitions of all the keywords.
+         *
+         * Used to check that a cached deck was parsed with the same keyword
+         * definitions. The generated default keywords are represented by a
+         * hash of their definitions computed by genkw, and the keywords
+         * added later by the code which creates them, in the order they
+         * were added.
+         */
+        std::string keywordDefinitions() const;
+
     private:
+        template <class T>
+        static ParserKeyword createKeyword() {
+            return T();
+        }
+
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const string_view& keyword) const;
+        const ParserKeyword* lazyKeyword(const string_view& keyword) const;
         void addDefaultKeywords();
+        void updateWildCardCandidates();
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
         std::list<ParserKeyword> keyword_storage;
 
         // associative map of deck names and the corresponding ParserKeyword object
-        std::map< string_view, const ParserKeyword* > m_deckParserKeywords;
+        std::unordered_map< string_view, const ParserKeyword* > m_deckParserKeywords;
 
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
         std::map< string_view, const ParserKeyword* > m_wildCardKeywords;
 
+        // The wildcard keywords which can match a deck name starting with a
+        // given character, in the same order as m_wildCardKeywords. Rebuilt
+        // from m_wildCardKeywords when a wildcard keyword is added.
+        std::array< std::vector< const ParserKeyword* >, 128 > m_wildCardCandidates;
+
         std::vector<std::pair<std::string,std::string>> code_keywords;
+        bool defer_data_keywords = false;
+        std::string deck_cache_directory;
+
+        // The keywords added with addLazyKeyword(), they are instantiated on
+        // first lookup and are not entered in m_deckParserKeywords.
+        struct LazyKeywords;
+        std::unique_ptr<LazyKeywords> lazy_keywords;
+
+        // Hash of the generated default keyword definitions, set by
+        // addDefaultKeywords(), and the number of keywords in
+        // keyword_storage and lazy_keywords added by it.
+        std::string default_keywords_hash;
+        std::size_t default_keyword_count = 0;
+        std::size_t default_lazy_count = 0;
     };
 
 } // namespace Opm
@@ -35,6 +35,7 @@ namespace Opm {
 
     class UnitSystem;
     class RawRecord;
+    class string_view;
 
 
     /*
@@ -95,6 +96,14 @@ namespace Opm {
 
         DeckItem scan( RawRecord& rawRecord, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const;
 
+        /*
+          Create the item with a copy of the text in data, which is only
+          tokenized when the values are accessed. Large inputs are tokenized
+          in parallel chunks. Only integer and double items of size ALL, i.e.
+          the item of a data keyword, can be deferred.
+        */
+        DeckItem scanDeferred( const string_view& data, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const;
+
         std::string size_literal() const;
         const std::string className() const;
         std::string createCode(const std::string& indent) const;
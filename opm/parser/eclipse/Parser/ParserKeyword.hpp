@@ -94,6 +94,7 @@ namespace Opm {
         static bool validDeckName(const string_view& name);
         bool hasMatchRegex() const;
         void setMatchRegex(const std::string& deckNameRegexp);
+        const std::string& getMatchRegex() const;
         bool matches(const string_view& ) const;
         bool hasDimension() const;
         void addRecord( ParserRecord );
@@ -24,6 +24,8 @@
 
 namespace Opm {
 
+    class DeckCacheIO;
+
     class Dimension {
     public:
         Dimension();
@@ -44,6 +46,8 @@ namespace Opm {
         bool operator!=( const Dimension& ) const;
 
     private:
+        friend class DeckCacheIO;
+
         std::string m_name;
         double m_SIfactor;
         double m_SIoffset;
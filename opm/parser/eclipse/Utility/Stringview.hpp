@@ -21,7 +21,9 @@
 #define OPM_UTILITY_SUBSTRING_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <functional>
 #include <iosfwd>
 #include <stdexcept>
 #include <string>
@@ -193,7 +195,8 @@ namespace Opm {
     }
 
     inline bool string_view::operator==( const string_view& rhs ) const {
-        return std::equal( this->begin(), this->end(), rhs.begin() );
+        return this->size() == rhs.size() &&
+               std::equal( this->begin(), this->end(), rhs.begin() );
     }
 
     inline bool string_view::empty() const {
@@ -286,4 +289,24 @@ namespace Opm {
 
 }
 
+namespace std {
+    /*
+     * FNV-1a hash of the viewed characters, so that string_view can be used
+     * as key in unordered containers; the keyword names this is used for are
+     * short and a cheap byte-wise hash is faster than std::hash<std::string>
+     * which would need a temporary string.
+     */
+    template<>
+    struct hash< Opm::string_view > {
+        std::size_t operator()( const Opm::string_view& view ) const {
+            std::size_t h = 14695981039346656037ULL;
+            for( const auto c : view ) {
+                h ^= static_cast< unsigned char >( c );
+                h *= 1099511628211ULL;
+            }
+            return h;
+        }
+    };
+}
+
 #endif //OPM_UTILITY_SUBSTRING_HPP
@@ -19,12 +19,16 @@
 #include <opm/io/eclipse/ESmry.hpp>
 
 #include <exception>
+#include <functional>
 #include <string>
 #include <string.h>
 #include <sstream>
 #include <iterator>
 #include <iomanip>
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <limits>
 #include <limits.h>
@@ -35,6 +39,8 @@
 #include <boost/filesystem.hpp> 
 
 #include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
 /*
 
      KEYWORDS       WGNAMES        NUMS              |   PARAM index   Corresponding ERT key
@@ -57,7 +63,8 @@
 
 namespace Opm { namespace EclIO {
 
-ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
+ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
+    withBaseRunData(loadBaseRunData)
 {
 
     boost::filesystem::path inputFileName(filename);
@@ -75,7 +82,6 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
     }
 
     bool formatted = inputFileName.extension()==".SMSPEC" ? false : true;
-    formattedVect.push_back(formatted);
     
     boost::filesystem::path path = boost::filesystem::current_path();;
 
@@ -90,148 +96,111 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
     std::set<std::string> keywList;
     std::vector<std::pair<std::string,int>> smryArray;
 
-    // Read data from the summary into local data members.
-    {
-        EclFile smspec1(smspec_file.string());
+    // summary keys in SMSPEC order for each run, empty if not a valid key
+    std::vector<std::vector<std::string>> runKeys;
+
+    std::vector<int> mainDimens;
+
+    // Walk the restart chain, reading each SMSPEC file once. Supporting nested restarts
+    // (restart, from restart, ...), std::set keywList is storing keywords from all runs involved
 
-        smspec1.loadData();   // loading all data
+    boost::filesystem::path smspecFile = smspec_file;
 
-        std::vector<int> dimens = smspec1.get<int>("DIMENS");
+    while (true) {
+        EclFile smspec(smspecFile.string());
+
+        smspec.loadData();   // loading all data
+
+        std::vector<int> dimens = smspec.get<int>("DIMENS");
 
         nI = dimens[1]; // This is correct -- dimens[0] is something else!
         nJ = dimens[2];
         nK = dimens[3];
 
-        std::vector<std::string> restartArray = smspec1.get<std::string>("RESTART");
-        std::vector<std::string> keywords = smspec1.get<std::string>("KEYWORDS");
-        std::vector<std::string> wgnames = smspec1.get<std::string>("WGNAMES");
-        std::vector<int> nums = smspec1.get<int>("NUMS");
-
-        for (unsigned int i=0; i<keywords.size(); i++) {
-            std::string str1 = makeKeyString(keywords[i], wgnames[i], nums[i]);
-            if (str1.length() > 0) {
-                keywList.insert(str1);
-            }
+        if (mainDimens.empty()) {
+            mainDimens = dimens;
         }
-        
-        getRstString(restartArray, pathRstFile, rstRootN);
-        
-        smryArray.push_back({smspec_file.string(), dimens[5]});
-    }
 
-    // checking if this is a restart run. Supporting nested restarts (restart, from restart, ...)
-    // std::set keywList is storing keywords from all runs involved
-    
-    while ((rstRootN.string() != "") && (loadBaseRunData)) {
-        
-        boost::filesystem::path rstFile = pathRstFile / rstRootN;
-        rstFile += ".SMSPEC";
-        
-        bool baseRunFmt = false;
-        
-        // if unformatted file not exists, check for formatted file
-        if (!boost::filesystem::exists(rstFile)){
-            rstFile = pathRstFile / rstRootN;
-            rstFile += ".FSMSPEC";
-            
-            baseRunFmt = true;
-        }
-        
-        EclFile smspec_rst(rstFile.string());
-        smspec_rst.loadData();
+        std::vector<std::string> restartArray = smspec.get<std::string>("RESTART");
+        std::vector<std::string> keywords = smspec.get<std::string>("KEYWORDS");
+        std::vector<std::string> wgnames = smspec.get<std::string>("WGNAMES");
+        std::vector<int> nums = smspec.get<int>("NUMS");
 
-        std::vector<int> dimens = smspec_rst.get<int>("DIMENS");
-        std::vector<std::string> restartArray = smspec_rst.get<std::string>("RESTART");
-        std::vector<std::string> keywords = smspec_rst.get<std::string>("KEYWORDS");
-        std::vector<std::string> wgnames = smspec_rst.get<std::string>("WGNAMES");
-        std::vector<int> nums = smspec_rst.get<int>("NUMS");
+        std::vector<std::string> keys;
+        keys.reserve(keywords.size());
 
         for (size_t i = 0; i < keywords.size(); i++) {
-            std::string str1 = makeKeyString(keywords[i], wgnames[i], nums[i]);
-            if (str1.length() > 0) {
-                keywList.insert(str1);
+            keys.push_back(makeKeyString(keywords[i], wgnames[i], nums[i]));
+
+            if (keys.back().length() > 0) {
+                keywList.insert(keys.back());
             }
         }
 
-        smryArray.push_back({rstFile.string(),dimens[5]});
-        
-        formattedVect.push_back(baseRunFmt);
+        runKeys.push_back(std::move(keys));
+        smryArray.push_back({smspecFile.string(), dimens[5]});
+        formattedVect.push_back(formatted);
 
         getRstString(restartArray, pathRstFile, rstRootN);
-    }
 
-    int nFiles = static_cast<int>(smryArray.size());
-    
-    // arrayInd should hold indices for each vector and runs
-    // n=file number, i = position in param array in file n (one array pr time step), example arrayInd[n][i] = position in keyword list (std::set) 
+        if ((rstRootN.string() == "") || (!loadBaseRunData)) {
+            break;
+        }
 
-    std::vector<std::vector<int>> arrayInd;
-    
-    for (int i = 0; i < nFiles; i++){
-        arrayInd.push_back({});
-    }
-    
-    int n = nFiles - 1;
+        smspecFile = pathRstFile / rstRootN;
+        smspecFile += ".SMSPEC";
+
+        formatted = false;
+
+        // if unformatted file not exists, check for formatted file
+        if (!boost::filesystem::exists(smspecFile)){
+            smspecFile = pathRstFile / rstRootN;
+            smspecFile += ".FSMSPEC";
 
+            formatted = true;
+        }
+    }
 
-    while (n >= 0){
+    nI = mainDimens[1];
+    nJ = mainDimens[2];
+    nK = mainDimens[3];
 
-        auto smry = smryArray[n];
+    int nFiles = static_cast<int>(smryArray.size());
 
-        EclFile smspec(std::get<0>(smry));
-        smspec.loadData();
+    // keyword list (sorted) and hashed key -> vector index map, shared by all runs
 
-        std::vector<int> dimens = smspec.get<int>("DIMENS");
+    nVect = keywList.size();
 
-        nI = dimens[1];
-        nJ = dimens[2];
-        nK = dimens[3];
+    keyword.assign(keywList.begin(), keywList.end());
+    keyIndex.reserve(keyword.size());
 
-        std::vector<std::string> keywords = smspec.get<std::string>("KEYWORDS");
-        std::vector<std::string> wgnames = smspec.get<std::string>("WGNAMES");
-        std::vector<int> nums = smspec.get<int>("NUMS");
+    for (size_t i = 0; i < keyword.size(); i++) {
+        keyIndex.emplace(keyword[i], static_cast<int>(i));
+    }
 
-        std::vector<int> tmpVect(keywords.size(), -1);
-        arrayInd[n]=tmpVect;
+    // position of each vector in the PARAMS arrays of each run
 
-        std::set<std::string>::iterator it;
+    paramsPos.assign(nFiles, std::vector<int>(nVect, -1));
 
-        for (size_t i=0; i < keywords.size(); i++) {
-            std::string keyw = makeKeyString(keywords[i], wgnames[i], nums[i]);
-            it = std::find(keywList.begin(), keywList.end(), keyw);
+    for (int run = 0; run < nFiles; run++) {
+        for (size_t i = 0; i < runKeys[run].size(); i++) {
+            auto it = keyIndex.find(runKeys[run][i]);
 
-            if (it != keywList.end()){
-                arrayInd[n][i] = distance(keywList.begin(), it);
+            if (it != keyIndex.end()) {
+                paramsPos[run][it->second] = static_cast<int>(i);
             }
         }
-        
-        n--;
     }
 
-    // param array used to stor data for the object, defined in the private section of the class 
-    param.assign(keywList.size(), {});
+    // result files of all runs, starting with the first base run
     
-    int fromReportStepNumber = 0;
-    int toReportStepNumber;
+    std::vector<std::string> resultsFileList;
+    std::vector<int> resultsFileRun;
 
-    float time = 0.0;
-    int step = 0;
+    for (int n = nFiles - 1; n >= 0; n--) {
 
-    n = nFiles - 1;
-
-    while (n >= 0){
-
-        int reportStepNumber = fromReportStepNumber;
-
-        if (n > 0) {
-            auto rstFrom = smryArray[n-1];
-            toReportStepNumber = std::get<1>(rstFrom);
-        } else {
-            toReportStepNumber = std::numeric_limits<int>::max();
-        }
-
-        boost::filesystem::path smspecFile(std::get<0>(smryArray[n]));
-        rootName = smspecFile.parent_path() / smspecFile.stem();
+        boost::filesystem::path runSmspecFile(std::get<0>(smryArray[n]));
+        rootName = runSmspecFile.parent_path() / runSmspecFile.stem();
 
         
         // check if multiple or unified result files should be used 
@@ -247,7 +216,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
 
         std::vector<std::string> multFileList = checkForMultipleResultFiles(rootName, formattedVect[n]);
 
-        std::vector<std::string> resultsFileList;
+        std::vector<std::string> runFileList;
         
         if ((!use_unified) && (multFileList.size()==0)){
             throw std::runtime_error("neigther unified or non-unified result files found");
@@ -256,33 +225,80 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
             auto time_unified = boost::filesystem::last_write_time(unsmryFile);
             
             if (time_multiple > time_unified){
-                resultsFileList=multFileList;
+                runFileList=multFileList;
             } else {
-                resultsFileList.push_back(unsmryFile.string());
+                runFileList.push_back(unsmryFile.string());
             }
             
         } else if (use_unified){
-            resultsFileList.push_back(unsmryFile.string());
+            runFileList.push_back(unsmryFile.string());
         } else {
-            resultsFileList=multFileList;
+            runFileList=multFileList;
         }
-        
+
+        for (const auto& fileName : runFileList) {
+            resultsFileList.push_back(fileName);
+            resultsFileRun.push_back(n);
+        }
+    }
+
+    // scan array headers of all result files concurrently, summary data is loaded on demand
+
+    smryFiles.resize(resultsFileList.size());
+
+    std::exception_ptr error;
+
+#pragma omp parallel for schedule(dynamic)
+    for (int f = 0; f < static_cast<int>(resultsFileList.size()); f++) {
+        try {
+            smryFiles[f] = std::make_unique<EclFile>(resultsFileList[f]);
+        } catch (...) {
+#pragma omp critical
+            if (!error) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    int fromReportStepNumber = 0;
+    int toReportStepNumber;
+
+    // time steps ending a report step
+    std::vector<bool> reportStepEnd;
+
+    for (int n = nFiles - 1; n >= 0; n--) {
+
+        int reportStepNumber = fromReportStepNumber;
+
+        if (n > 0) {
+            auto rstFrom = smryArray[n-1];
+            toReportStepNumber = std::get<1>(rstFrom);
+        } else {
+            toReportStepNumber = std::numeric_limits<int>::max();
+        }
+
         // make array list with reference to source files (unifed or non unified)
         
-        std::vector<std::tuple<std::string, std::string, int>> arraySourceList;
+        std::vector<std::tuple<std::string, int, int>> arraySourceList;
 
-        for (std::string fileName : resultsFileList){
-            EclFile unsmry(fileName);
-                
-            std::vector<EclFile::EclEntry> arrayList = unsmry.getList();
+        for (size_t fileIndex = 0; fileIndex < smryFiles.size(); fileIndex++){
+            if (resultsFileRun[fileIndex] != n) {
+                continue;
+            }
+
+            std::vector<EclFile::EclEntry> arrayList = smryFiles[fileIndex]->getList();
 
             for (size_t nn = 0; nn < arrayList.size(); nn++){
-                std::tuple<std::string, std::string, int> t1 = std::make_tuple(std::get<0>(arrayList[nn]), fileName, static_cast<int>(nn));
+                std::tuple<std::string, int, int> t1 = std::make_tuple(std::get<0>(arrayList[nn]), static_cast<int>(fileIndex), static_cast<int>(nn));
                 arraySourceList.push_back(t1);
             }
         }
 
-        // loop through arrays and extract symmary data from result files, arrays PARAMS
+        // loop through arrays and register PARAMS array of each time step in result files
         //
         //    2 or 3 arrays pr time step.
         //       If timestep is a report step:  MINISTEP, PARAMS and SEQHDR
@@ -290,9 +306,6 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
 
         size_t i = std::get<0>(arraySourceList[0]) == "SEQHDR" ? 1 : 0 ;
 
-        std::string prevFile;
-        std::unique_ptr<EclFile> pEclFile;
-
         while  (i < arraySourceList.size()){
 
             if (std::get<0>(arraySourceList[i]) != "MINISTEP"){
@@ -307,23 +320,8 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
             
             i++;
 
-            if (std::get<1>(arraySourceList[i]) != prevFile){
-                pEclFile = std::make_unique<EclFile>(std::get<1>(arraySourceList[i]));
-                pEclFile->loadData();
-                
-                prevFile = std::get<1>(arraySourceList[i]);
-            }    
-            
-            int m = std::get<2>(arraySourceList[i]);
-            
-            std::vector<float> tmpData = pEclFile->get<float>(m);
-
-            time = tmpData[0];
-
-            if (time == 0.0) {
-                seqTime.push_back(time);
-                seqIndex.push_back(step);
-            }
+            timeStepList.push_back(std::make_tuple(n, std::get<1>(arraySourceList[i]), std::get<2>(arraySourceList[i])));
+            reportStepEnd.push_back(false);
 
             i++;
 
@@ -331,45 +329,403 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData)
                 if (std::get<0>(arraySourceList[i]) == "SEQHDR") {
                     i++;
                     reportStepNumber++;
-                    seqTime.push_back(time);
-                    seqIndex.push_back(step);
+                    reportStepEnd.back() = true;
                 }
             } else {
                 reportStepNumber++;
-                seqTime.push_back(time);
-                seqIndex.push_back(step);
+                reportStepEnd.back() = true;
             }
-            
-            // adding defaut values (0.0) in case vector not found in this particular summary file
-            
-            for (size_t ii = 0; ii < param.size(); ii++){            
-                param[ii].push_back(0.0);
+
+            if (reportStepNumber >= toReportStepNumber) {
+                i = arraySourceList.size();
+            }
+        }
+
+        fromReportStepNumber = toReportStepNumber;
+    }
+
+    // time is first element in all PARAMS arrays
+
+    std::vector<float> timeValues(timeStepList.size());
+
+    readTimeSteps(std::vector<std::vector<int>>(nFiles, { 0 }),
+                  [&timeValues](int step, const std::vector<float>& values)
+                  {
+                      timeValues[step] = values[0];
+                  });
+
+    for (size_t step = 0; step < timeStepList.size(); step++) {
+        if (timeValues[step] == 0.0) {
+            seqTime.push_back(timeValues[step]);
+            seqIndex.push_back(step);
+        }
+
+        if (reportStepEnd[step]) {
+            seqTime.push_back(timeValues[step]);
+            seqIndex.push_back(step);
+        }
+    }
+
+    param.assign(nVect, {});
+    vectorLoaded.assign(nVect, false);
+
+    // use transposed summary data if available and up to date
+
+    lodsmryFile = smspec_file;
+    lodsmryFile.replace_extension(".LODSMRY");
+
+    for (const auto& smry : smryArray) {
+        lodSourceFiles.push_back(std::get<0>(smry));
+    }
+
+    for (const auto& smryFile : smryFiles) {
+        lodSourceFiles.push_back(smryFile->fileName());
+    }
+
+    boost::system::error_code ec;
+
+    if (boost::filesystem::exists(lodsmryFile, ec)) {
+        try {
+            lodFile = std::make_unique<EclFile>(lodsmryFile.string());
+
+            if (!lodsmryFileUpToDate()) {
+                lodFile.reset();
+            }
+        }
+        catch (const std::exception&) {
+            lodFile.reset();
+        }
+    }
+}
+
+
+bool ESmry::lodsmryFileUpToDate() const
+{
+    const auto arrays = lodFile->getList();
+
+    if ((static_cast<int>(arrays.size()) != nVect + 2) ||
+        (std::get<0>(arrays[0]) != "DIMENS") || (std::get<1>(arrays[0]) != INTE) ||
+        (std::get<0>(arrays[1]) != "SOURCES") || (std::get<1>(arrays[1]) != DOUB)) {
+        return false;
+    }
+
+    const std::vector<int> expectedDimens = {nVect, static_cast<int>(timeStepList.size()), withBaseRunData ? 1 : 0};
+
+    if (lodFile->get<int>(0) != expectedDimens) {
+        return false;
+    }
+
+    // Modification times are only compared for equality, a source file
+    // rewritten within the same second as the LODSMRY file, or replaced
+    // by an older copy, is then still detected.
+
+    const auto stamps = sourceFileStamps();
+
+    return !stamps.empty() && (lodFile->get<double>(1) == stamps);
+}
+
+
+std::vector<double> ESmry::sourceFileStamps() const
+{
+    std::vector<double> stamps;
+
+    for (const auto& fileName : lodSourceFiles) {
+        struct stat st;
+
+        if (stat(fileName.c_str(), &st) != 0) {
+            return {};
+        }
+
+#if defined(__APPLE__)
+        const auto& mtime = st.st_mtimespec;
+#else
+        const auto& mtime = st.st_mtim;
+#endif
+
+        stamps.push_back(static_cast<double>(st.st_size));
+        stamps.push_back(static_cast<double>(mtime.tv_sec));
+        stamps.push_back(static_cast<double>(mtime.tv_nsec));
+    }
+
+    return stamps;
+}
+
+
+void ESmry::make_lodsmry_file()
+{
+    lodFile.reset();
+
+    const std::string tmpFile = lodsmryFile.string() + ".tmp";
+
+    {
+        EclOutput outFile(tmpFile, false);
+
+        outFile.write("DIMENS", std::vector<int>{nVect, static_cast<int>(timeStepList.size()), withBaseRunData ? 1 : 0});
+        outFile.write("SOURCES", sourceFileStamps());
+
+        // vectors are extracted in batches to limit memory consumption
+
+        const int batchSize = 1000;
+
+        for (int first = 0; first < nVect; first += batchSize) {
+            const int last = std::min(first + batchSize, nVect);
+
+            std::vector<std::string> batch(keyword.begin() + first, keyword.begin() + last);
+            std::vector<bool> wasLoaded(vectorLoaded.begin() + first, vectorLoaded.begin() + last);
+
+            loadData(batch);
+
+            for (int ind = first; ind < last; ind++) {
+                std::string name = keyword[ind].substr(0, keyword[ind].find(':')).substr(0, 8);
+
+                outFile.write(name, param[ind]);
+
+                if (!wasLoaded[ind - first]) {
+                    param[ind].clear();
+                    param[ind].shrink_to_fit();
+                    vectorLoaded[ind] = false;
+                }
             }
+        }
+    }
+
+    boost::filesystem::rename(tmpFile, lodsmryFile);
+
+    lodFile = std::make_unique<EclFile>(lodsmryFile.string());
+    lodFile->writeIndex();
+}
+
+
+void ESmry::readParams(std::fstream& fileH, int& openFile, int step,
+                       const std::vector<int>& elements, std::vector<float>& values) const
+{
+    const int fileIndex = std::get<1>(timeStepList[step]);
+    const int arrIndex = std::get<2>(timeStepList[step]);
+
+    EclFile& smryFile = *smryFiles[fileIndex];
+
+    values.resize(elements.size());
+
+    if (smryFile.formattedInput()) {
+        const std::vector<float>& data = smryFile.get<float>(arrIndex);
+
+        for (size_t m = 0; m < elements.size(); m++) {
+            values[m] = data[elements[m]];
+        }
+
+        // only the extracted columns are kept, not the PARAMS array itself
+
+        smryFile.clearData();
+
+        return;
+    }
+
+    if (fileIndex != openFile) {
+        fileH.close();
+        fileH.open(smryFile.fileName(), std::ios::in | std::ios::binary);
+
+        if (!fileH) {
+            std::string message = "Could not open file: '" + smryFile.fileName() + "'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        openFile = fileIndex;
+    }
+
+    if ((smryFile.arrayType(arrIndex) != REAL) ||
+        (!elements.empty() && elements.back() >= smryFile.arraySize(arrIndex))) {
+        OPM_THROW(std::runtime_error, "Inconsistent PARAMS array in file: '" + smryFile.fileName() + "'");
+    }
+
+    // Byte offset of element in binary REAL array, relative to stream
+    // position of array data.  Data is split in blocks of 1000 elements,
+    // each enclosed by a 4 byte head and tail.
+
+    const int blockSize = MaxBlockSizeReal / sizeOfReal;
+
+    auto offset = [blockSize](int elm) -> std::streamoff
+    {
+        return sizeOfInte + static_cast<std::streamoff>(elm / blockSize) * (MaxBlockSizeReal + 2 * sizeOfInte)
+            + (elm % blockSize) * sizeOfReal;
+    };
+
+    // Elements (sorted) close to each other are read with a single
+    // operation, such that a strided gather of many vectors touches
+    // each part of the array only once.
+
+    const std::streamoff maxGap = 4096;
+    const std::streamoff arrPos = smryFile.dataPosition(arrIndex);
+
+    std::vector<char> buffer;
+
+    size_t first = 0;
+    while (first < elements.size()) {
+        size_t last = first + 1;
+
+        while ((last < elements.size()) && (offset(elements[last]) - offset(elements[last - 1]) <= maxGap)) {
+            last++;
+        }
+
+        const std::streamoff from = offset(elements[first]);
+        const std::streamoff to = offset(elements[last - 1]) + sizeOfReal;
+
+        buffer.resize(to - from);
+
+        fileH.seekg(arrPos + from);
+        fileH.read(buffer.data(), buffer.size());
+
+        if (!fileH) {
+            OPM_THROW(std::runtime_error, "Error reading PARAMS array in file: '" + smryFile.fileName() + "'");
+        }
+
+        for (size_t m = first; m < last; m++) {
+            float value;
+            std::memcpy(&value, buffer.data() + (offset(elements[m]) - from), sizeof(value));
+            values[m] = flipEndianFloat(value);
+        }
+
+        first = last;
+    }
+}
+
+
+void ESmry::readTimeSteps(const std::vector<std::vector<int>>& runElements,
+                          const std::function<void(int, const std::vector<float>&)>& store) const
+{
+    // time steps are grouped in segments sharing the same result file,
+    // segments are read concurrently each with its own file handle
+
+    std::vector<std::pair<int, int>> segments;
+
+    for (int step = 0; step < static_cast<int>(timeStepList.size()); step++) {
+        if (segments.empty() || (std::get<1>(timeStepList[step]) != std::get<1>(timeStepList[step - 1]))) {
+            segments.emplace_back(step, step + 1);
+        } else {
+            segments.back().second = step + 1;
+        }
+    }
+
+    std::exception_ptr error;
+
+#pragma omp parallel for schedule(dynamic)
+    for (int seg = 0; seg < static_cast<int>(segments.size()); seg++) {
+        try {
+            std::fstream fileH;
+            int openFile = -1;
+
+            std::vector<float> values;
+
+            for (int step = segments[seg].first; step < segments[seg].second; step++) {
+                const auto& elements = runElements[std::get<0>(timeStepList[step])];
 
-            for (size_t j = 0; j < tmpData.size(); j++) {
-                int ind = arrayInd[n][j];
-                
-                if (ind > -1) {
-                   param[ind][step] = tmpData[j];        
+                if (elements.empty()) {
+                    continue;
                 }
+
+                readParams(fileH, openFile, step, elements, values);
+                store(step, values);
+            }
+        } catch (...) {
+#pragma omp critical
+            if (!error) {
+                error = std::current_exception();
             }
+        }
+    }
 
-            if (reportStepNumber >= toReportStepNumber) {
-                i = arraySourceList.size();
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+
+void ESmry::loadData() const
+{
+    loadData(keyword);
+}
+
+
+void ESmry::loadData(const std::vector<std::string>& vectList) const
+{
+    std::lock_guard<std::mutex> lock(*loadMutex);
+    loadVectors(vectList);
+}
+
+
+void ESmry::loadVectors(const std::vector<std::string>& vectList) const
+{
+    std::vector<int> keywIndex;
+
+    for (const auto& name : vectList) {
+        int ind = keywordIndex(name);
+
+        if (!vectorLoaded[ind]) {
+            keywIndex.push_back(ind);
+        }
+    }
+
+    std::sort(keywIndex.begin(), keywIndex.end());
+    keywIndex.erase(std::unique(keywIndex.begin(), keywIndex.end()), keywIndex.end());
+
+    if (keywIndex.empty()) {
+        return;
+    }
+
+    // one contiguous array pr vector in transposed summary file
+
+    if (lodFile) {
+        for (int ind : keywIndex) {
+            param[ind] = lodFile->get<float>(ind + 2);
+            vectorLoaded[ind] = true;
+        }
+
+        lodFile->clearData();
+
+        return;
+    }
+
+    // positions in PARAMS array (sorted) and corresponding vector, for each run
+
+    const size_t nRuns = paramsPos.size();
+
+    std::vector<std::vector<int>> runElements(nRuns);
+    std::vector<std::vector<int>> runVectors(nRuns);
+
+    for (size_t run = 0; run < nRuns; run++) {
+        std::vector<std::pair<int, int>> posList;
+
+        for (int ind : keywIndex) {
+            if (paramsPos[run][ind] > -1) {
+                posList.emplace_back(paramsPos[run][ind], ind);
             }
+        }
+
+        std::sort(posList.begin(), posList.end());
 
-            step++;
+        for (const auto& pos : posList) {
+            runElements[run].push_back(pos.first);
+            runVectors[run].push_back(pos.second);
         }
+    }
 
-        fromReportStepNumber = toReportStepNumber;
+    // adding defaut values (0.0) in case vector not found in a particular summary file
 
-        n--;
+    for (int ind : keywIndex) {
+        param[ind].assign(timeStepList.size(), 0.0);
     }
 
-    nVect = keywList.size();
+    readTimeSteps(runElements,
+                  [this, &runVectors](int step, const std::vector<float>& values)
+                  {
+                      const int run = std::get<0>(timeStepList[step]);
 
-    for (auto keyw : keywList){
-        keyword.push_back(keyw);
+                      for (size_t m = 0; m < values.size(); m++) {
+                          param[runVectors[run][m]][step] = values[m];
+                      }
+                  });
+
+    for (int ind : keywIndex) {
+        vectorLoaded[ind] = true;
     }
 }
 
@@ -421,7 +777,20 @@ void ESmry::updatePathAndRootName(boost::filesystem::path& dir, boost::filesyste
 
 bool ESmry::hasKey(const std::string &key) const
 {
-    return std::find(keyword.begin(), keyword.end(), key) != keyword.end();
+    return keyIndex.find(key) != keyIndex.end();
+}
+
+
+int ESmry::keywordIndex(const std::string& name) const
+{
+    auto it = keyIndex.find(name);
+
+    if (it == keyIndex.end()) {
+        std::string message="keyword " + name + " not found ";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return it->second;
 }
 
 
@@ -497,14 +866,13 @@ std::string ESmry::makeKeyString(const std::string& keywordArg, const std::strin
 
 const std::vector<float>& ESmry::get(const std::string& name) const
 {
-    auto it = std::find(keyword.begin(), keyword.end(), name);
+    int ind = keywordIndex(name);
 
-    if (it == keyword.end()) {
-        std::string message="keyword " + name + " not found ";
-        OPM_THROW(std::invalid_argument, message);
-    }
+    std::lock_guard<std::mutex> lock(*loadMutex);
 
-    int ind = std::distance(keyword.begin(), it);
+    if (!vectorLoaded[ind]) {
+        loadVectors({ name });
+    }
 
     return param[ind];
 }
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstdint>
 #include <cstring>
 #include <functional>
 #include <fstream>
@@ -31,6 +32,8 @@
 #include <string>
 #include <numeric>
 
+#include <boost/filesystem.hpp>
+
 
 // anonymous namespace for EclFile
 
@@ -188,76 +191,151 @@ unsigned long int sizeOnDiskFormatted(const int num, Opm::EclIO::eclArrType arrT
 }
 
 
-template<typename T, typename T2>
-std::vector<T> readBinaryArray(std::fstream& fileH, const int size, Opm::EclIO::eclArrType type,
-                               std::function<T(T2)>& flip)
+template <typename BlockOp>
+void forEachBinaryBlock(std::fstream& fileH, const int size, Opm::EclIO::eclArrType type,
+                        std::vector<char>& buffer, BlockOp&& blockOp)
 {
-    std::vector<T> arr;
-
     auto sizeData = block_size_data_binary(type);
     int sizeOfElement = std::get<0>(sizeData);
     int maxBlockSize = std::get<1>(sizeData);
     int maxNumberOfElements = maxBlockSize / sizeOfElement;
 
-    arr.reserve(size);
+    // Read the complete record, including the Fortran block markers,
+    // with a single stream operation and decode it from memory.
 
+    buffer.resize(sizeOnDiskBinary(size, type));
+    fileH.read(buffer.data(), buffer.size());
+
+    if (static_cast<std::size_t>(fileH.gcount()) != buffer.size()) {
+        OPM_THROW(std::runtime_error, "Error reading binary data, unexpected end of file");
+    }
+
+    const char* pos = buffer.data();
+    const char* end = pos + buffer.size();
+
+    int offset = 0;
     int rest = size;
     while (rest > 0) {
+        if (end - pos < 2 * Opm::EclIO::sizeOfInte) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
         int dhead;
-        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        std::memcpy(&dhead, pos, sizeof(dhead));
         dhead = Opm::EclIO::flipEndianInt(dhead);
+        pos += sizeof(dhead);
 
         int num = dhead / sizeOfElement;
 
-        if ((num > maxNumberOfElements) || (num < 0)) {
+        if ((num > maxNumberOfElements) || (num < 0) || (num > rest) ||
+            (end - pos < static_cast<long int>(num) * sizeOfElement + Opm::EclIO::sizeOfInte)) {
             OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
         }
 
-        for (int i = 0; i < num; i++) {
-            T2 value;
-            fileH.read(reinterpret_cast<char*>(&value), sizeOfElement);
-            arr.push_back(flip(value));
-        }
+        blockOp(pos, offset, num);
+        pos += num * sizeOfElement;
 
+        offset += num;
         rest -= num;
 
-        if (( num < maxNumberOfElements && rest != 0) ||
-            (num == maxNumberOfElements && rest < 0)) {
+        if (num < maxNumberOfElements && rest != 0) {
             std::string message = "Error reading binary data, incorrect number of elements";
             OPM_THROW(std::runtime_error, message);
         }
 
         int dtail;
-        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        std::memcpy(&dtail, pos, sizeof(dtail));
         dtail = Opm::EclIO::flipEndianInt(dtail);
+        pos += sizeof(dtail);
 
         if (dhead != dtail) {
             OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
         }
     }
+}
+
+
+template<typename T, typename T2>
+std::vector<T> readBinaryArray(std::fstream& fileH, const int size, Opm::EclIO::eclArrType type,
+                               std::function<T(T2)>& flip)
+{
+    std::vector<T> arr;
+    std::vector<char> buffer;
+
+    arr.reserve(size);
+
+    forEachBinaryBlock(fileH, size, type, buffer,
+                       [&arr, &flip](const char* data, int, int num)
+                       {
+                           for (int i = 0; i < num; i++) {
+                               T2 value;
+                               std::memcpy(&value, data + i*sizeof(T2), sizeof(T2));
+                               arr.push_back(flip(value));
+                           }
+                       });
+
+    return arr;
+}
+
+
+// Numeric arrays are copied block-wise straight into the result and
+// byte-swapped in place afterwards.  Swapping through an unsigned integer
+// of the same width keeps the loop simple enough for the compiler to
+// vectorise.
+
+template<typename T, typename UInt>
+std::vector<T> readBinaryNumArray(std::fstream& fileH, const int size, Opm::EclIO::eclArrType type,
+                                  UInt (*bswap)(UInt))
+{
+    static_assert(sizeof(T) == sizeof(UInt), "Element and swap type must have equal size");
+
+    std::vector<T> arr(size);
+    std::vector<char> buffer;
+
+    forEachBinaryBlock(fileH, size, type, buffer,
+                       [&arr](const char* data, int offset, int num)
+                       {
+                           std::memcpy(arr.data() + offset, data, num * sizeof(T));
+                       });
+
+    for (auto& value : arr) {
+        UInt tmp;
+        std::memcpy(&tmp, &value, sizeof(T));
+        tmp = bswap(tmp);
+        std::memcpy(&value, &tmp, sizeof(T));
+    }
 
     return arr;
 }
 
 
+std::uint32_t bswap32(std::uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+
+std::uint64_t bswap64(std::uint64_t value)
+{
+    return __builtin_bswap64(value);
+}
+
+
 std::vector<int> readBinaryInteArray(std::fstream &fileH, const int size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f);
+    return readBinaryNumArray<int>(fileH, size, Opm::EclIO::INTE, bswap32);
 }
 
 
 std::vector<float> readBinaryRealArray(std::fstream& fileH, const int size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f);
+    return readBinaryNumArray<float>(fileH, size, Opm::EclIO::REAL, bswap32);
 }
 
 
 std::vector<double> readBinaryDoubArray(std::fstream& fileH, const int size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f);
+    return readBinaryNumArray<double>(fileH, size, Opm::EclIO::DOUB, bswap64);
 }
 
 std::vector<bool> readBinaryLogiArray(std::fstream &fileH, const int size)
@@ -448,6 +526,251 @@ std::vector<double> readFormattedDoubArray(const std::string& file_str, const in
     return readFormattedArray<double>(file_str, size, fromPos, f);
 }
 
+// Sidecar index file layout (native byte order, it is a local cache):
+//
+//   magic "OPMEIDX" (8 bytes incl. terminator), format version, number
+//   of indexed bytes and modification time of indexed file, number of
+//   arrays, and for each array: name (8 chars), type, size, stream
+//   position of array data.
+
+const char indexMagic[8] = "OPMEIDX";
+const std::int32_t indexVersion = 2;
+
+struct FileStamp
+{
+    std::uint64_t size;
+    std::int64_t mtime;
+};
+
+// Array headers of the leading 'length' bytes of a file.
+struct ArrayHeaders
+{
+    std::vector<std::string> names;
+    std::vector<Opm::EclIO::eclArrType> types;
+    std::vector<int> sizes;
+    std::vector<unsigned long int> positions;
+
+    std::uint64_t length = 0;
+    std::int64_t mtime = 0;
+};
+
+bool fileStamp(const std::string& filename, FileStamp& stamp)
+{
+    boost::system::error_code ec;
+
+    const auto size = boost::filesystem::file_size(filename, ec);
+    if (ec) {
+        return false;
+    }
+
+    const auto mtime = boost::filesystem::last_write_time(filename, ec);
+    if (ec) {
+        return false;
+    }
+
+    stamp.size = static_cast<std::uint64_t>(size);
+    stamp.mtime = static_cast<std::int64_t>(mtime);
+
+    return true;
+}
+
+template <typename T>
+void writeRaw(std::ofstream& os, const T& value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <typename T>
+bool readRaw(std::ifstream& is, T& value)
+{
+    is.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return static_cast<bool>(is);
+}
+
+unsigned long int sizeOnDisk(const bool formatted, const int num, Opm::EclIO::eclArrType arrType)
+{
+    return formatted ? sizeOnDiskFormatted(num, arrType) : sizeOnDiskBinary(num, arrType);
+}
+
+// Append headers of all arrays from stream position 'from' to end of file.
+void scanHeaders(std::fstream& fileH, const bool formatted, const unsigned long int from,
+                 ArrayHeaders& headers)
+{
+    fileH.seekg(from);
+
+    while (!isEOF(&fileH)) {
+        std::string arrName(8,' ');
+        Opm::EclIO::eclArrType arrType;
+        int num;
+
+        if (formatted) {
+            readFormattedHeader(fileH,arrName,num,arrType);
+        } else {
+            readBinaryHeader(fileH,arrName,num,arrType);
+        }
+
+        const unsigned long int pos = fileH.tellg();
+
+        headers.names.push_back(Opm::EclIO::trimr(arrName));
+        headers.types.push_back(arrType);
+        headers.sizes.push_back(num);
+        headers.positions.push_back(pos);
+
+        // Skip array data by seeking rather than reading through it.
+        fileH.seekg(pos + sizeOnDisk(formatted, num, arrType));
+    }
+}
+
+bool readIndexFile(const std::string& indexFile, ArrayHeaders& headers)
+{
+    std::ifstream is(indexFile, std::ios::binary);
+    if (!is) {
+        return false;
+    }
+
+    char magic[sizeof(indexMagic)];
+    std::int32_t version;
+    std::uint64_t numArrays;
+
+    if (!(readRaw(is, magic) && readRaw(is, version) &&
+          readRaw(is, headers.length) && readRaw(is, headers.mtime) &&
+          readRaw(is, numArrays))) {
+        return false;
+    }
+
+    if ((std::memcmp(magic, indexMagic, sizeof(indexMagic)) != 0) || (version != indexVersion)) {
+        return false;
+    }
+
+    headers.names.reserve(numArrays);
+    headers.types.reserve(numArrays);
+    headers.sizes.reserve(numArrays);
+    headers.positions.reserve(numArrays + 1);
+
+    for (std::uint64_t i = 0; i < numArrays; i++) {
+        std::array<char, 8> name;
+        std::int32_t type, size;
+        std::uint64_t pos;
+
+        if (!(readRaw(is, name) && readRaw(is, type) && readRaw(is, size) && readRaw(is, pos))) {
+            return false;
+        }
+
+        if ((type < Opm::EclIO::INTE) || (type > Opm::EclIO::MESS) || (size < 0) || (pos > headers.length)) {
+            return false;
+        }
+
+        headers.names.push_back(Opm::EclIO::trimr(std::string(name.begin(), name.end())));
+        headers.types.push_back(static_cast<Opm::EclIO::eclArrType>(type));
+        headers.sizes.push_back(size);
+        headers.positions.push_back(pos);
+    }
+
+    return true;
+}
+
+void writeIndexFile(const std::string& indexFile, const ArrayHeaders& headers)
+{
+    // Write to temporary file and rename, such that concurrent readers
+    // never see a partially written index.
+
+    const auto tmpFile = indexFile + ".tmp";
+
+    {
+        std::ofstream os(tmpFile, std::ios::binary);
+
+        if (!os) {
+            OPM_THROW(std::runtime_error, "Could not open index file: '" + tmpFile + "'");
+        }
+
+        writeRaw(os, indexMagic);
+        writeRaw(os, indexVersion);
+        writeRaw(os, headers.length);
+        writeRaw(os, headers.mtime);
+        writeRaw(os, static_cast<std::uint64_t>(headers.names.size()));
+
+        for (std::size_t i = 0; i < headers.names.size(); i++) {
+            std::array<char, 8> name;
+            name.fill(' ');
+            std::copy_n(headers.names[i].begin(), std::min(headers.names[i].size(), name.size()), name.begin());
+
+            writeRaw(os, name);
+            writeRaw(os, static_cast<std::int32_t>(headers.types[i]));
+            writeRaw(os, static_cast<std::int32_t>(headers.sizes[i]));
+            writeRaw(os, static_cast<std::uint64_t>(headers.positions[i]));
+        }
+
+        if (!os) {
+            OPM_THROW(std::runtime_error, "Error writing index file: '" + tmpFile + "'");
+        }
+    }
+
+    boost::filesystem::rename(tmpFile, indexFile);
+}
+
+// Check that the index really describes the leading headers.length bytes
+// of the file: the data of the last array must end at that length, and
+// the header in front of that data must be the indexed one.  Size and
+// modification time alone do not identify a file which was rewritten.
+bool lastHeaderMatches(const std::string& filename, const bool formatted, const ArrayHeaders& headers)
+{
+    if (headers.names.empty()) {
+        return headers.length == 0;
+    }
+
+    const auto last = headers.names.size() - 1;
+    const auto pos = headers.positions[last];
+
+    try {
+        if (pos + sizeOnDisk(formatted, headers.sizes[last], headers.types[last]) != headers.length) {
+            return false;
+        }
+
+        std::fstream fileH(filename, formatted ? std::ios::in : (std::ios::in | std::ios::binary));
+        if (!fileH) {
+            return false;
+        }
+
+        std::string arrName(8,' ');
+        Opm::EclIO::eclArrType arrType;
+        int num;
+
+        if (formatted) {
+            // Header is the line which ends in front of the array data.
+            const auto tail = std::min<unsigned long int>(pos, 128);
+            std::string buffer(tail, ' ');
+
+            fileH.seekg(pos - tail);
+            fileH.read(&buffer[0], tail);
+
+            if (!fileH || buffer.empty() || (buffer.back() != '\n')) {
+                return false;
+            }
+
+            const auto lineEnd = buffer.find_last_of('\n', buffer.size() - 2);
+            const auto lineStart = (lineEnd == std::string::npos) ? 0 : lineEnd + 1;
+
+            fileH.seekg(pos - tail + lineStart);
+            readFormattedHeader(fileH, arrName, num, arrType);
+        } else {
+            // Binary header is 16 bytes of data between two record markers.
+            if (pos < 24) {
+                return false;
+            }
+
+            fileH.seekg(pos - 24);
+            readBinaryHeader(fileH, arrName, num, arrType);
+        }
+
+        return fileH && (static_cast<unsigned long int>(fileH.tellg()) == pos)
+            && (Opm::EclIO::trimr(arrName) == headers.names[last])
+            && (arrType == headers.types[last]) && (num == headers.sizes[last]);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
 } // anonymous namespace
 
 // ==========================================================================
@@ -461,10 +784,14 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
         OPM_THROW(std::invalid_argument, message);
     }
 
-    std::fstream fileH;
-
     formatted = isFormatted(filename);
 
+    if (this->loadIndex()) {
+        return;
+    }
+
+    std::fstream fileH;
+
     if (formatted) {
         fileH.open(filename, std::ios::in);
     } else {
@@ -476,40 +803,21 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
         OPM_THROW(std::runtime_error, message);
     }
 
-    int n = 0;
-    while (!isEOF(&fileH)) {
-        std::string arrName(8,' ');
-        eclArrType arrType;
-        int num;
-
-        if (formatted) {
-            readFormattedHeader(fileH,arrName,num,arrType);
-        } else {
-            readBinaryHeader(fileH,arrName,num,arrType);
-        }
+    ArrayHeaders headers;
+    scanHeaders(fileH, formatted, 0, headers);
 
-        array_size.push_back(num);
-        array_type.push_back(arrType);
+    array_name = std::move(headers.names);
+    array_type = std::move(headers.types);
+    array_size = std::move(headers.sizes);
+    ifStreamPos = std::move(headers.positions);
 
-        array_name.push_back(trimr(arrName));
+    for (std::size_t n = 0; n < array_name.size(); n++) {
         array_index[array_name[n]] = n;
+    }
 
-        unsigned long int pos = fileH.tellg();
-        ifStreamPos.push_back(pos);
-
-        arrayLoaded.push_back(false);
-
-        if (formatted) {
-            unsigned long int sizeOfNextArray = sizeOnDiskFormatted(num, arrType);
-            fileH.ignore(sizeOfNextArray);
-        } else {
-            unsigned long int sizeOfNextArray = sizeOnDiskBinary(num, arrType);
-            fileH.ignore(sizeOfNextArray);
-        }
-
-        n++;
-    };
+    arrayLoaded.assign(array_name.size(), false);
 
+    fileH.clear();
     fileH.seekg(0, std::ios_base::end);
     this->ifStreamPos.push_back(static_cast<unsigned long>(fileH.tellg()));
 
@@ -517,6 +825,103 @@ EclFile::EclFile(const std::string& filename) : inputFilename(filename)
 }
 
 
+std::string EclFile::indexFileName(const std::string& filename)
+{
+    return filename + ".idx";
+}
+
+
+bool EclFile::loadIndex()
+{
+    FileStamp stamp;
+    if (!fileStamp(inputFilename, stamp)) {
+        return false;
+    }
+
+    ArrayHeaders headers;
+    if (!readIndexFile(indexFileName(inputFilename), headers)) {
+        return false;
+    }
+
+    if ((headers.length != stamp.size) || (headers.mtime != stamp.mtime) ||
+        !lastHeaderMatches(inputFilename, formatted, headers)) {
+        return false;
+    }
+
+    headers.positions.push_back(stamp.size);
+
+    array_name = std::move(headers.names);
+    array_type = std::move(headers.types);
+    array_size = std::move(headers.sizes);
+    ifStreamPos = std::move(headers.positions);
+
+    array_index.clear();
+    for (std::size_t i = 0; i < array_name.size(); i++) {
+        array_index[array_name[i]] = i;
+    }
+
+    arrayLoaded.assign(array_name.size(), false);
+
+    return true;
+}
+
+
+void EclFile::writeIndex() const
+{
+    FileStamp stamp;
+    if (!fileStamp(inputFilename, stamp)) {
+        OPM_THROW(std::runtime_error, "Could not determine size of file: '" + inputFilename + "'");
+    }
+
+    ArrayHeaders headers;
+    headers.names = array_name;
+    headers.types = array_type;
+    headers.sizes = array_size;
+    headers.positions.assign(ifStreamPos.begin(), ifStreamPos.begin() + array_name.size());
+    headers.length = stamp.size;
+    headers.mtime = stamp.mtime;
+
+    writeIndexFile(indexFileName(inputFilename), headers);
+}
+
+
+void EclFile::updateIndex(const std::string& filename)
+{
+    FileStamp stamp;
+    if (!fileStamp(filename, stamp)) {
+        OPM_THROW(std::runtime_error, "Could not determine size of file: '" + filename + "'");
+    }
+
+    const bool fmt = isFormatted(filename);
+    const auto indexFile = indexFileName(filename);
+
+    // Reuse the entries of an index which matches the leading part of the
+    // file, such that only the arrays appended since are scanned.
+
+    ArrayHeaders headers;
+    if (!readIndexFile(indexFile, headers) || (headers.length > stamp.size) ||
+        !lastHeaderMatches(filename, fmt, headers)) {
+        headers = ArrayHeaders{};
+    }
+
+    if ((headers.length == stamp.size) && (headers.mtime == stamp.mtime)) {
+        return;
+    }
+
+    std::fstream fileH(filename, fmt ? std::ios::in : (std::ios::in | std::ios::binary));
+    if (!fileH) {
+        OPM_THROW(std::runtime_error, "Could not open file: " + filename);
+    }
+
+    scanHeaders(fileH, fmt, headers.length, headers);
+
+    headers.length = stamp.size;
+    headers.mtime = stamp.mtime;
+
+    writeIndexFile(indexFile, headers);
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
@@ -24,7 +24,9 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdio>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
@@ -33,6 +35,67 @@
 #include <stdexcept>
 #include <typeinfo>
 
+namespace {
+
+std::uint32_t byteSwap(std::uint32_t value)
+{
+    return __builtin_bswap32(value);
+}
+
+std::uint64_t byteSwap(std::uint64_t value)
+{
+    return __builtin_bswap64(value);
+}
+
+// Convert elements [from, from + num) of data to type Disk and store
+// them big endian in buffer.  Plain loop over whole blocks, which the
+// compiler is free to vectorise.
+template <typename Disk, typename UInt, typename T>
+void storeBigEndian(const T* data, std::size_t from, std::size_t num, char* buffer)
+{
+    static_assert(sizeof(Disk) == sizeof(UInt), "Byte swap type must match element size");
+
+    for (std::size_t i = 0; i < num; i++) {
+        const Disk value = static_cast<Disk>(data[from + i]);
+
+        UInt tmp;
+        std::memcpy(&tmp, &value, sizeof(tmp));
+        tmp = byteSwap(tmp);
+        std::memcpy(buffer + i * sizeof(tmp), &tmp, sizeof(tmp));
+    }
+}
+
+void fillBinaryBlock(const std::vector<int>& data, std::size_t from, std::size_t num, char* buffer)
+{
+    storeBigEndian<int, std::uint32_t>(data.data(), from, num, buffer);
+}
+
+void fillBinaryBlock(const std::vector<float>& data, std::size_t from, std::size_t num, char* buffer)
+{
+    storeBigEndian<float, std::uint32_t>(data.data(), from, num, buffer);
+}
+
+void fillBinaryBlock(const std::vector<double>& data, std::size_t from, std::size_t num, char* buffer)
+{
+    storeBigEndian<double, std::uint64_t>(data.data(), from, num, buffer);
+}
+
+void fillBinaryBlock(const std::vector<bool>& data, std::size_t from, std::size_t num, char* buffer)
+{
+    for (std::size_t i = 0; i < num; i++) {
+        const unsigned int intVal = data[from + i] ? Opm::EclIO::true_value : Opm::EclIO::false_value;
+        std::memcpy(buffer + i * sizeof(intVal), &intVal, sizeof(intVal));
+    }
+}
+
+void fillBinaryBlock(const std::vector<char>&, std::size_t, std::size_t, char*)
+{
+    std::cerr << "type not supported in write binaryarray\n";
+    std::exit(EXIT_FAILURE);
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
 EclOutput::EclOutput(const std::string&            filename,
@@ -77,6 +140,25 @@ void EclOutput::write<PaddedOutputString<8>>
     }
 }
 
+void EclOutput::writeAsFloat(const std::string& name,
+                             const std::vector<double>& data)
+{
+    if (isFormatted)
+    {
+        writeFormattedHeader(name, data.size(), REAL);
+        writeFormattedArray(std::vector<float>(data.begin(), data.end()));
+    }
+    else
+    {
+        writeBinaryHeader(name, data.size(), REAL);
+        writeBinaryBlocks(REAL, data.size(),
+                          [&data](char* buffer, std::size_t from, std::size_t num)
+                          {
+                              storeBigEndian<float, std::uint32_t>(data.data(), from, num, buffer);
+                          });
+    }
+}
+
 void EclOutput::message(const std::string& msg)
 {
     // Generate message, i.e., output vector of type eclArrType::MESS,
@@ -128,18 +210,47 @@ void EclOutput::writeBinaryHeader(const std::string&arrName, int size, eclArrTyp
 }
 
 
-template <typename T>
-void EclOutput::writeBinaryArray(const std::vector<T>& data)
+template <typename Fill>
+void EclOutput::writeBinaryBlocks(eclArrType arrType, std::size_t size, Fill&& fill)
 {
-    int rest,num,rval;
-    int dhead;
-    float value_f;
-    double value_d;
-    int intVal;
+    auto sizeData = block_size_data_binary(arrType);
 
-    int n = 0;
-    int size = data.size();
+    const int sizeOfElement = std::get<0>(sizeData);
+    const int maxBlockSize = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
+
+    if (!ofileH.is_open()) {
+        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
+    }
+
+    // each block, including the leading and trailing block size markers,
+    // is assembled in blockBuffer and written with a single call
 
+    blockBuffer.resize(maxBlockSize + 2 * sizeof(int));
+
+    std::size_t n = 0;
+    while (n < size) {
+        const std::size_t num = std::min(size - n, maxNumberOfElements);
+        const std::size_t blockSize = num * sizeOfElement;
+
+        const int dhead = flipEndianInt(static_cast<int>(blockSize));
+
+        char* buffer = blockBuffer.data();
+
+        std::memcpy(buffer, &dhead, sizeof(dhead));
+        fill(buffer + sizeof(dhead), n, num);
+        std::memcpy(buffer + sizeof(dhead) + blockSize, &dhead, sizeof(dhead));
+
+        ofileH.write(buffer, blockSize + 2 * sizeof(dhead));
+
+        n += num;
+    }
+}
+
+
+template <typename T>
+void EclOutput::writeBinaryArray(const std::vector<T>& data)
+{
     eclArrType arrType = MESS;
 
     if (typeid(std::vector<T>) == typeid(std::vector<int>)) {
@@ -152,53 +263,11 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         arrType = LOGI;
     }
 
-    auto sizeData = block_size_data_binary(arrType);
-
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
-
-    if (!ofileH.is_open()) {
-        OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
-    }
-
-    rest = size * sizeOfElement;
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = rest / sizeOfElement;
-            rest = 0;
-        }
-
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        for (int i = 0; i < num; i++) {
-            if (arrType == INTE) {
-                rval = flipEndianInt(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&rval), sizeof(rval));
-            } else if (arrType == REAL) {
-                value_f = flipEndianFloat(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_f), sizeof(value_f));
-            } else if (arrType == DOUB) {
-                value_d = flipEndianDouble(data[n]);
-                ofileH.write(reinterpret_cast<char*>(&value_d), sizeof(value_d));
-            } else if (arrType == LOGI) {
-                intVal = data[n] ? true_value : false_value;
-                ofileH.write(reinterpret_cast<char*>(&intVal), sizeOfElement);
-            } else {
-                std::cerr << "type not supported in write binaryarray\n";
-                std::exit(EXIT_FAILURE);
-            }
-
-            n++;
-        }
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-    }
+    writeBinaryBlocks(arrType, data.size(),
+                      [&data](char* buffer, std::size_t from, std::size_t num)
+                      {
+                          fillBinaryBlock(data, from, num, buffer);
+                      });
 }
 
 
@@ -211,80 +280,31 @@ template void EclOutput::writeBinaryArray<char>(const std::vector<char>& data);
 
 void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data)
 {
-    int num,dhead;
-
-    int n = 0;
-    int size = data.size();
-
-    auto sizeData = block_size_data_binary(CHAR);
-
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
-
-    int rest = size * sizeOfElement;
-
-    if (!ofileH.is_open()) {
-        OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
-    }
-
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = rest / sizeOfElement;
-            rest = 0;
-        }
-
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        for (int i = 0; i < num; i++) {
-            std::string tmpStr = data[n] + std::string(8 - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
-            n++;
-        }
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-    }
+    writeBinaryBlocks(CHAR, data.size(),
+                      [&data](char* buffer, std::size_t from, std::size_t num)
+                      {
+                          for (std::size_t i = 0; i < num; i++, buffer += 8) {
+                              const auto& str = data[from + i];
+
+                              if (str.size() > 8) {
+                                  OPM_THROW(std::invalid_argument, "String '" + str + "' longer than 8 characters");
+                              }
+
+                              std::memcpy(buffer, str.c_str(), str.size());
+                              std::memset(buffer + str.size(), ' ', 8 - str.size());
+                          }
+                      });
 }
 
 void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data)
 {
-    const auto size = data.size();
-
-    const auto sizeData = block_size_data_binary(CHAR);
-
-    const int sizeOfElement       = std::get<0>(sizeData);
-    const int maxBlockSize        = std::get<1>(sizeData);
-    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
-
-    int rest = size * sizeOfElement;
-
-    if (!ofileH.is_open()) {
-        OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
-    }
-
-    auto elm = data.begin();
-    while (rest > 0) {
-        const auto numElm = (rest > maxBlockSize)
-            ? maxNumberOfElements
-            : rest / sizeOfElement;
-
-        rest = (rest > maxBlockSize) ? rest - maxBlockSize : 0;
-
-        auto dhead = flipEndianInt(numElm * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        for (auto i = 0*numElm; i < numElm; ++i, ++elm) {
-            ofileH.write(elm->c_str(), sizeOfElement);
-        }
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-    }
+    writeBinaryBlocks(CHAR, data.size(),
+                      [&data](char* buffer, std::size_t from, std::size_t num)
+                      {
+                          for (std::size_t i = 0; i < num; i++, buffer += 8) {
+                              std::memcpy(buffer, data[from + i].c_str(), 8);
+                          }
+                      });
 }
 
 void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclArrType arrType)
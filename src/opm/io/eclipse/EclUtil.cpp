@@ -21,6 +21,8 @@
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 
 
@@ -33,10 +35,12 @@ int Opm::EclIO::flipEndianInt(int num)
 
 float Opm::EclIO::flipEndianFloat(float num)
 {
-    float value = num;
+    std::uint32_t tmp;
+    std::memcpy(&tmp, &num, sizeof(num));
+    tmp = __builtin_bswap32(tmp);
 
-    char* floatToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(floatToConvert, floatToConvert+4);
+    float value;
+    std::memcpy(&value, &tmp, sizeof(value));
 
     return value;
 }
@@ -44,10 +48,12 @@ float Opm::EclIO::flipEndianFloat(float num)
 
 double Opm::EclIO::flipEndianDouble(double num)
 {
-    double value = num;
+    std::uint64_t tmp;
+    std::memcpy(&tmp, &num, sizeof(num));
+    tmp = __builtin_bswap64(tmp);
 
-    char* doubleToConvert = reinterpret_cast<char*>(&value);
-    std::reverse(doubleToConvert, doubleToConvert+8);
+    double value;
+    std::memcpy(&value, &tmp, sizeof(value));
 
     return value;
 }
@@ -98,6 +98,17 @@ namespace {
         }
     } // namespace FileExtension
 
+    void indexFile(const std::string& filename)
+    {
+        // The array header index only accelerates subsequent readers.
+        // Failing to create it must not affect the simulation run.
+        try {
+            Opm::EclIO::EclFile::updateIndex(filename);
+        }
+        catch (const std::exception&) {
+        }
+    }
+
     namespace Open
     {
         namespace Init
@@ -302,6 +313,7 @@ Restart(const ResultSet& rset,
     if (unif.set) {
         // Run uses unified restart files.
         this->openUnified(fname, fmt.set, seqnum);
+        this->unifiedFile_ = fname;
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
@@ -314,16 +326,26 @@ Restart(const ResultSet& rset,
 }
 
 Opm::EclIO::OutputStream::Restart::~Restart()
-{}
+{
+    this->closeAndIndex();
+}
 
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
-    : stream_{ std::move(rhs.stream_) }
-{}
+    : stream_     { std::move(rhs.stream_) }
+    , unifiedFile_{ std::move(rhs.unifiedFile_) }
+{
+    rhs.unifiedFile_.clear();
+}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
-    this->stream_ = std::move(rhs.stream_);
+    this->closeAndIndex();
+
+    this->stream_      = std::move(rhs.stream_);
+    this->unifiedFile_ = std::move(rhs.unifiedFile_);
+
+    rhs.unifiedFile_.clear();
 
     return *this;
 }
@@ -361,6 +383,13 @@ write(const std::string& kw, const std::vector<double>& data)
     this->writeImpl(kw, data);
 }
 
+void
+Opm::EclIO::OutputStream::Restart::
+writeAsFloat(const std::string& kw, const std::vector<double>& data)
+{
+    this->stream().writeAsFloat(kw, data);
+}
+
 void
 Opm::EclIO::OutputStream::Restart::
 write(const std::string& kw, const std::vector<std::string>& data)
@@ -461,6 +490,18 @@ Opm::EclIO::OutputStream::Restart::stream()
     return *this->stream_;
 }
 
+void Opm::EclIO::OutputStream::Restart::closeAndIndex()
+{
+    if (! this->stream_ || this->unifiedFile_.empty()) {
+        return;
+    }
+
+    // Index must describe complete file contents, so close stream first.
+    this->stream_.reset();
+
+    indexFile(this->unifiedFile_);
+}
+
 namespace Opm { namespace EclIO { namespace OutputStream {
 
     template <typename T>
@@ -794,6 +835,19 @@ Opm::EclIO::OutputStream::createSummaryFile(const ResultSet& rset,
     };
 }
 
+void
+Opm::EclIO::OutputStream::indexUnifiedSummaryFile(const ResultSet& rset,
+                                                  const Formatted& fmt)
+{
+    const auto fname = outputFileName(rset, FileExtension::summary(0, fmt.set, true));
+
+    // Called from destructors; a file system error must not escape.
+    boost::system::error_code ec;
+    if (boost::filesystem::exists(fname, ec)) {
+        indexFile(fname);
+    }
+}
+
 // =====================================================================
 
 std::string
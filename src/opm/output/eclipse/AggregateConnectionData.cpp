@@ -54,14 +54,14 @@ namespace {
     }
 
     template <class ConnOp>
-    void connectionLoop(const std::vector<Opm::Well2>& wells,
-                        const Opm::EclipseGrid&        grid,
-                        ConnOp&&                       connOp)
+    void connectionLoop(const std::vector<const Opm::Well2*>& wells,
+                        const Opm::EclipseGrid&               grid,
+                        ConnOp&&                              connOp)
     {
         for (auto nWell = wells.size(), wellID = 0*nWell;
              wellID < nWell; ++wellID)
         {
-            const auto& well = wells[wellID];
+            const auto& well = *wells[wellID];
             std::vector<const Opm::Connection*> connSI;
             for (const auto& conn : well.getConnections()) {
                 if (grid.cellActive(conn.getI(), conn.getJ(), conn.getK()))
@@ -278,13 +278,14 @@ captureDeclaredConnData(const Schedule&        sched,
                         const data::WellRates& xw,
                         const std::size_t      sim_step)
 {
-    const auto& wells = sched.getWells2(sim_step);
+    const auto& wells = sched.getWells2Ptr(sim_step);
     //
     // construct a composite vector of connection objects  holding
     // rates for all open connectons
     //
     std::map<std::string, std::vector<const Opm::data::Connection*> > allWellConnections;
-    for (const auto& wl : wells) {
+    for (const auto* well_ptr : wells) {
+        const auto& wl = *well_ptr;
         const auto& conn0 = wl.getConnections();
         const auto  conns = WellConnections(conn0, grid);
         std::vector<const Opm::data::Connection*> initConn (conns.size(), nullptr);
@@ -732,13 +732,13 @@ captureDeclaredMSWData(const Schedule&         sched,
                        const Opm::data::WellRates&  wr
                        )
 {
-    const auto& wells = sched.getWells2(rptStep);
+    const auto& wells = sched.getWells2Ptr(rptStep);
     auto msw = std::vector<const Opm::Well2*>{};
 
     //msw.reserve(wells.size());
-    for (const auto& well : wells) {
-        if (well.isMultiSegment())
-            msw.push_back(&well);
+    for (const auto* well : wells) {
+        if (well->isMultiSegment())
+            msw.push_back(well);
     }
     // Extract Contributions to ISeg Array
     {
@@ -74,13 +74,13 @@ namespace {
     }
 
     template <typename WellOp>
-    void wellLoop(const std::vector<Opm::Well2>& wells,
-                  WellOp&&                       wellOp)
+    void wellLoop(const std::vector<const Opm::Well2*>& wells,
+                  WellOp&&                              wellOp)
     {
         for (auto nWell = wells.size(), wellID = 0*nWell;
              wellID < nWell; ++wellID)
         {
-            const auto& well = wells[wellID];
+            const auto& well = *wells[wellID];
 
             wellOp(well, wellID);
         }
@@ -792,7 +792,7 @@ captureDeclaredWellData(const Schedule&   sched,
                         const ::Opm::SummaryState&  smry,
                         const std::vector<int>& inteHead)
 {
-    const auto& wells = sched.getWells2(sim_step);
+    const auto& wells = sched.getWells2Ptr(sim_step);
 
     // Static contributions to IWEL array.
     {
@@ -847,7 +847,7 @@ captureDynamicWellData(const Schedule&             sched,
                        const Opm::data::WellRates& xw,
                        const ::Opm::SummaryState&  smry)
 {
-    const auto& wells = sched.getWells2(sim_step);
+    const auto& wells = sched.getWells2Ptr(sim_step);
 
     // Dynamic contributions to IWEL array.
     wellLoop(wells, [this, &xw]
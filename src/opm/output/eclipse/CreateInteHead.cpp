@@ -48,8 +48,8 @@ namespace {
     {
         auto ncwmax = 0;
 
-        for (const auto& well : sched.getWells2(lookup_step)) {
-            const auto ncw = well.getConnections().size();
+        for (const auto* well : sched.getWells2Ptr(lookup_step)) {
+            const auto ncw = well->getConnections().size();
 
             ncwmax = std::max(ncwmax, static_cast<int>(ncw));
         }
@@ -217,13 +217,13 @@ namespace {
     {
 	const auto& wsd = rspec.wellSegmentDimensions();
 
-        const auto& sched_wells = sched.getWells2(lookup_step);
+        const auto& sched_wells = sched.getWells2Ptr(lookup_step);
 
         const auto nsegwl =
             std::count_if(std::begin(sched_wells), std::end(sched_wells),
-                          [](const Opm::Well2& well)
+                          [](const Opm::Well2* well)
             {
-                return well.isMultiSegment();
+                return well->isMultiSegment();
             });
 
         const auto nswlmx = wsd.maxSegmentedWells();
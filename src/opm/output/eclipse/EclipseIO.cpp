@@ -45,12 +45,20 @@
 
 #include <opm/io/eclipse/OutputStream.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+
 #include <algorithm>
+#include <condition_variable>
 #include <cstdlib>
 #include <cctype>
+#include <deque>
+#include <exception>
+#include <functional>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
 
@@ -91,6 +99,120 @@ void ensure_directory_exists( const boost::filesystem::path& odir )
     }
 }
 
+/*
+  Bounded queue of output jobs serviced by a single writer thread. Jobs
+  are run in the order they are pushed. If the queue is full push()
+  blocks until the writer has completed a job. An exception thrown by a
+  job is stored, all pending jobs are discarded and the exception is
+  rethrown from the next call to push() or flush().
+*/
+class OutputQueue {
+public:
+    explicit OutputQueue(std::size_t max_pending)
+        : max_pending_( std::max(max_pending, std::size_t{1}) )
+        , worker_( [this]() { this->run(); } )
+    {}
+
+    ~OutputQueue()
+    {
+        {
+            std::unique_lock<std::mutex> lock(this->mutex_);
+            this->job_done_.wait(lock, [this]() { return this->jobs_.empty(); });
+            this->stop_ = true;
+        }
+
+        this->job_added_.notify_one();
+        this->worker_.join();
+    }
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    void push(std::function<void()> job)
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->job_done_.wait(lock, [this]()
+        {
+            return (this->jobs_.size() < this->max_pending_) || this->error_;
+        });
+
+        this->rethrow();
+
+        this->jobs_.push_back(std::move(job));
+        lock.unlock();
+
+        this->job_added_.notify_one();
+    }
+
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+        this->job_done_.wait(lock, [this]() { return this->jobs_.empty(); });
+
+        this->rethrow();
+    }
+
+private:
+    std::size_t max_pending_;
+    std::deque<std::function<void()>> jobs_{};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::mutex mutex_{};
+    std::condition_variable job_added_{};
+    std::condition_variable job_done_{};
+
+    // Last member, started once the remaining members are initialised.
+    std::thread worker_;
+
+    // Front of jobs_ is the job currently being run, it is removed
+    // when completed such that an empty queue means all output done.
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(this->mutex_);
+
+        while (true) {
+            this->job_added_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->jobs_.empty();
+            });
+
+            if (this->jobs_.empty())
+                return;
+
+            auto& job = this->jobs_.front();
+
+            lock.unlock();
+            std::exception_ptr error{};
+            try {
+                job();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+            lock.lock();
+
+            if (error) {
+                this->error_ = error;
+                this->jobs_.clear();
+            }
+            else
+                this->jobs_.pop_front();
+
+            this->job_done_.notify_all();
+        }
+    }
+
+    void rethrow()
+    {
+        if (this->error_) {
+            auto error = this->error_;
+            this->error_ = nullptr;
+            std::rethrow_exception(error);
+        }
+    }
+};
+
 }
 
 namespace Opm {
@@ -99,6 +221,9 @@ class EclipseIO::Impl {
     Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& );
         void writeINITFile( const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const NNC& nnc) const;
         void writeEGRIDFile( const NNC& nnc );
+        void writeTimeStep( const SummaryState& st, int report_step, bool isSubstep,
+                            double secs_elapsed, const RestartValue& value,
+                            bool write_double );
 
         const EclipseState& es;
         EclipseGrid grid;
@@ -107,6 +232,7 @@ class EclipseIO::Impl {
         std::string baseName;
         out::Summary summary;
         bool output_enabled;
+        std::unique_ptr<OutputQueue> output_queue;
 };
 
 EclipseIO::Impl::Impl( const EclipseState& eclipseState,
@@ -174,30 +300,23 @@ void EclipseIO::writeInitial( data::Solution simProps, std::map<std::string, std
 }
 
 // implementation of the writeTimeStep method
-void EclipseIO::writeTimeStep(const SummaryState& st,
-                              int report_step,
-                              bool  isSubstep,
-                              double secs_elapsed,
-                              RestartValue value,
-                              const bool write_double)
+void EclipseIO::Impl::writeTimeStep(const SummaryState& st,
+                                    int report_step,
+                                    bool  isSubstep,
+                                    double secs_elapsed,
+                                    const RestartValue& value,
+                                    const bool write_double)
  {
-    if (! this->impl->output_enabled) {
-        return;
-    }
-
-    const auto& es = this->impl->es;
-    const auto& grid = this->impl->grid;
-    const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
+    const auto& ioConfig = this->es.cfg().io();
 
     /*
       Summary data is written unconditionally for every timestep except for the
       very intial report_step==0 call, which is only garbage.
     */
     if (report_step > 0) {
-        this->impl->summary.add_timestep( st,
-                                          report_step);
-        this->impl->summary.write();
+        this->summary.add_timestep( st,
+                                    report_step);
+        this->summary.write();
     }
 
     /*
@@ -208,8 +327,8 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
     if(!isSubstep && es.cfg().restart().getWriteRestartFile(report_step))
     {
         EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             report_step,
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
@@ -228,8 +347,8 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
         };
 
         EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
             EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
             openExisting
         };
@@ -240,7 +359,51 @@ void EclipseIO::writeTimeStep(const SummaryState& st,
  }
 
 
+void EclipseIO::writeTimeStep(const SummaryState& st,
+                              int report_step,
+                              bool  isSubstep,
+                              double secs_elapsed,
+                              RestartValue value,
+                              const bool write_double)
+{
+    if (! this->impl->output_enabled) {
+        return;
+    }
+
+    if (! this->impl->output_queue) {
+        this->impl->writeTimeStep(st, report_step, isSubstep, secs_elapsed,
+                                  value, write_double);
+        return;
+    }
+
+    auto* impl_ptr = this->impl.get();
+    this->impl->output_queue->push(
+        [impl_ptr, st, report_step, isSubstep, secs_elapsed,
+         value = std::move(value), write_double]()
+    {
+        impl_ptr->writeTimeStep(st, report_step, isSubstep, secs_elapsed,
+                                value, write_double);
+    });
+}
+
+void EclipseIO::setAsyncOutput(bool async, std::size_t max_pending) {
+    this->flush();
+
+    this->impl->output_queue.reset();
+    if (async)
+        this->impl->output_queue.reset( new OutputQueue( max_pending ) );
+}
+
+void EclipseIO::flush() {
+    if (this->impl->output_queue)
+        this->impl->output_queue->flush();
+}
+
+
 RestartValue EclipseIO::loadRestart(SummaryState& summary_state, const std::vector<RestartKey>& solution_keys, const std::vector<RestartKey>& extra_keys) const {
+    if (this->impl->output_queue)
+        this->impl->output_queue->flush();
+
     const auto& es                       = this->impl->es;
     const auto& grid                     = this->impl->grid;
     const auto& schedule                 = this->impl->schedule;
@@ -268,10 +431,19 @@ EclipseIO::EclipseIO( const EclipseState& es,
 }
 
 const out::Summary& EclipseIO::summary() {
+    this->flush();
+
     return this->impl->summary;
 }
 
 
-EclipseIO::~EclipseIO() {}
+EclipseIO::~EclipseIO() {
+    try {
+        this->flush();
+    }
+    catch (const std::exception& e) {
+        OpmLog::error(std::string("Asynchronous output failed: ") + e.what());
+    }
+}
 
 } // namespace Opm
@@ -696,17 +696,17 @@ namespace {
     void checkWellVectorSizes(const std::vector<int>&                   opm_iwel,
                               const std::vector<double>&                opm_xwel,
                               const std::vector<Opm::data::Rates::opt>& phases,
-                              const std::vector<Opm::Well2>&            sched_wells)
+                              const std::vector<const Opm::Well2*>&     sched_wells)
     {
         const auto expected_xwel_size =
             std::accumulate(sched_wells.begin(), sched_wells.end(),
                             std::size_t(0),
-                [&phases](const std::size_t acc, const Opm::Well2& w)
+                [&phases](const std::size_t acc, const Opm::Well2* w)
                 -> std::size_t
             {
                 return acc
                     + 2 + phases.size()
-                    + (w.getConnections().size()
+                    + (w->getConnections().size()
                         * (phases.size() + Opm::data::Connection::restart_size));
             });
 
@@ -744,7 +744,7 @@ namespace {
 
         using rt = Opm::data::Rates::opt;
 
-        const auto& sched_wells = schedule.getWells2(rst_view.simStep());
+        const auto& sched_wells = schedule.getWells2Ptr(rst_view.simStep());
         std::vector<rt> phases;
         {
             const auto& phase = es.runspec().phases();
@@ -760,8 +760,8 @@ namespace {
         auto opm_xwel_data = opm_xwel.begin();
         auto opm_iwel_data = opm_iwel.begin();
 
-        for (const auto& sched_well : sched_wells) {
-            auto& well = wells[ sched_well.name() ];
+        for (const auto* sched_well : sched_wells) {
+            auto& well = wells[ sched_well->name() ];
 
             well.bhp         = *opm_xwel_data;  ++opm_xwel_data;
             well.temperature = *opm_xwel_data;  ++opm_xwel_data;
@@ -772,7 +772,7 @@ namespace {
                 ++opm_xwel_data;
             }
 
-            for (const auto& sc : sched_well.getConnections()) {
+            for (const auto& sc : sched_well->getConnections()) {
                 const auto i = sc.getI(), j = sc.getJ(), k = sc.getK();
 
                 if (!grid.cellActive(i, j, k) || sc.state() == Opm::Connection::State::SHUT) {
@@ -1068,11 +1068,11 @@ namespace {
         const auto& units  = es.getUnits();
         const auto& phases = es.runspec().phases();
 
-        const auto& wells = schedule.getWells2(rst_view->simStep());
+        const auto& wells = schedule.getWells2Ptr(rst_view->simStep());
         for (auto nWells = wells.size(), wellID = 0*nWells;
                   wellID < nWells; ++wellID)
         {
-            const auto& well = wells[wellID];
+            const auto& well = *wells[wellID];
 
             soln[well.name()] =
                 restore_well(well, wellID, grid, units,
@@ -1165,12 +1165,12 @@ namespace {
         // Well cumulatives
         {
             const auto  wellData = WellVectors { intehead, rst_view };
-            const auto& wells    = schedule.getWells2(sim_step);
+            const auto& wells    = schedule.getWells2Ptr(sim_step);
 
             for (auto nWells = wells.size(), wellID = 0*nWells;
                  wellID < nWells; ++wellID)
             {
-                assign_well_cumulatives(wells[wellID].name(),
+                assign_well_cumulatives(wells[wellID]->name(),
                                         wellID, wellData, smry);
             }
         }
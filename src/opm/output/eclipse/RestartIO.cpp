@@ -105,10 +105,10 @@ namespace {
     }
 
     std::vector<double>
-    serialize_OPM_XWEL(const data::Wells&             wells,
-                       const std::vector<Opm::Well2>& sched_wells,
-                       const Phases&                  phase_spec,
-                       const EclipseGrid&             grid)
+    serialize_OPM_XWEL(const data::Wells&                    wells,
+                       const std::vector<const Opm::Well2*>& sched_wells,
+                       const Phases&                         phase_spec,
+                       const EclipseGrid&                    grid)
     {
         using rt = data::Rates::opt;
 
@@ -118,7 +118,8 @@ namespace {
         if (phase_spec.active(Phase::GAS))   phases.push_back(rt::gas);
 
         std::vector< double > xwel;
-        for (const auto& sched_well : sched_wells) {
+        for (const auto* sched_well_ptr : sched_wells) {
+            const auto& sched_well = *sched_well_ptr;
             if (wells.count(sched_well.name()) == 0 ||
                 sched_well.getStatus() == Opm::Well2::Status::SHUT)
             {
@@ -321,7 +322,7 @@ namespace {
         // Extended set of OPM well vectors
         if (!ecl_compatible_rst)
         {
-            const auto sched_wells = schedule.getWells2(sim_step);
+            const auto sched_wells = schedule.getWells2Ptr(sim_step);
             const auto sched_well_names = schedule.wellNames(sim_step);
 
             const auto opm_xwel =
@@ -425,9 +426,7 @@ namespace {
                 rstFile.write(key, data);
             }
             else {
-                rstFile.write(key, std::vector<float> {
-                    data.begin(), data.end()
-                });
+                rstFile.writeAsFloat(key, data);
             }
         };
 
@@ -537,14 +536,14 @@ void save(EclIO::OutputStream::Restart& rstFile,
 
     // Write well and MSW data only when applicable (i.e., when present)
     {
-        const auto& wells = schedule.getWells2(sim_step);
+        const auto& wells = schedule.getWells2Ptr(sim_step);
 
         if (! wells.empty()) {
             const auto haveMSW =
                 std::any_of(std::begin(wells), std::end(wells),
-                    [](const Well2& well)
+                    [](const Well2* well)
             {
-                return well.isMultiSegment();
+                return well->isMultiSegment();
             });
 
             if (haveMSW) {
@@ -50,13 +50,16 @@
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <cctype>
 #include <ctime>
 #include <exception>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <stdexcept>
 #include <string>
@@ -319,7 +322,7 @@ struct quantity {
  * is the index of the block in question. wells is simulation data.
  */
 struct fn_args {
-    const std::vector<Opm::Well2>& schedule_wells;
+    const std::vector<const Opm::Well2*>& schedule_wells;
     double duration;
     const int sim_step;
     int  num;
@@ -327,7 +330,7 @@ struct fn_args {
     const Opm::data::Wells& wells;
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::unordered_map<std::string, double>& eff_factors;
 };
 
 /* Since there are several enums in opm scattered about more-or-less
@@ -375,11 +378,8 @@ measure rate_unit< rt::well_potential_oil >() { return measure::liquid_surface_r
 template<> constexpr
 measure rate_unit< rt::well_potential_gas >() { return measure::gas_surface_rate; }
 
-double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name ) {
-    auto it = std::find_if( eff_factors.begin(), eff_factors.end(),
-                            [&] ( const std::pair< std::string, double > elem )
-                            { return elem.first == name; }
-                          );
+double efac( const std::unordered_map<std::string, double>& eff_factors, const std::string& name ) {
+    auto it = eff_factors.find( name );
 
     return (it != eff_factors.end()) ? it->second : 1;
 }
@@ -388,14 +388,14 @@ template< rt phase, bool injection = true, bool polymer = false >
 inline quantity rate( const fn_args& args ) {
     double sum = 0.0;
 
-    for( const auto& sched_well : args.schedule_wells ) {
-        const auto& name = sched_well.name();
+    for( const auto* sched_well : args.schedule_wells ) {
+        const auto& name = sched_well->name();
         if( args.wells.count( name ) == 0 ) continue;
 
         double eff_fac = efac( args.eff_factors, name );
 
         double concentration = polymer
-                             ? sched_well.getPolymerProperties().m_polymerConcentration
+                             ? sched_well->getPolymerProperties().m_polymerConcentration
                              : 1;
 
         const auto v = args.wells.at(name).rates.get(phase, 0.0) * eff_fac * concentration;
@@ -413,9 +413,9 @@ inline quantity rate( const fn_args& args ) {
 template< bool injection >
 inline quantity flowing( const fn_args& args ) {
     const auto& wells = args.wells;
-    auto pred = [&wells]( const Opm::Well2& w ) {
-        const auto& name = w.name();
-        return w.isInjector( ) == injection
+    auto pred = [&wells]( const Opm::Well2* w ) {
+        const auto& name = w->name();
+        return w->isInjector( ) == injection
             && wells.count( name ) > 0
             && wells.at( name ).flowing();
     };
@@ -436,7 +436,7 @@ inline quantity crate( const fn_args& args ) {
     const size_t global_index = args.num - 1;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -472,7 +472,7 @@ inline quantity srate( const fn_args& args ) {
     const size_t segNumber = args.num;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -503,7 +503,7 @@ inline quantity trans_factors ( const fn_args& args ) {
     // up a connection with offset 0.
     const size_t global_index = args.num - 1;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -532,7 +532,7 @@ inline quantity spr ( const fn_args& args ) {
     const size_t segNumber = args.num;
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto& well = args.schedule_wells.front();
+    const auto& well = *args.schedule_wells.front();
     const auto& name = well.name();
     if( args.wells.count( name ) == 0 ) return zero;
 
@@ -552,7 +552,7 @@ inline quantity bhp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front().name() );
+    const auto p = args.wells.find( args.schedule_wells.front()->name() );
     if( p == args.wells.end() ) return zero;
 
     return { p->second.bhp, measure::pressure };
@@ -562,7 +562,7 @@ inline quantity thp( const fn_args& args ) {
     const quantity zero = { 0, measure::pressure };
     if( args.schedule_wells.empty() ) return zero;
 
-    const auto p = args.wells.find( args.schedule_wells.front().name() );
+    const auto p = args.wells.find( args.schedule_wells.front()->name() );
     if( p == args.wells.end() ) return zero;
 
     return { p->second.thp, measure::pressure };
@@ -571,7 +571,7 @@ inline quantity thp( const fn_args& args ) {
 inline quantity bhp_history( const fn_args& args ) {
     if( args.schedule_wells.empty() ) return { 0.0, measure::pressure };
 
-    const Opm::Well2& sched_well = args.schedule_wells.front();
+    const Opm::Well2& sched_well = *args.schedule_wells.front();
 
     double bhp_hist;
     if ( sched_well.isProducer(  ) )
@@ -585,7 +585,7 @@ inline quantity bhp_history( const fn_args& args ) {
 inline quantity thp_history( const fn_args& args ) {
     if( args.schedule_wells.empty() ) return { 0.0, measure::pressure };
 
-    const Opm::Well2& sched_well = args.schedule_wells.front();
+    const Opm::Well2& sched_well = *args.schedule_wells.front();
 
     double thp_hist;
     if ( sched_well.isProducer() )
@@ -606,10 +606,10 @@ inline quantity production_history( const fn_args& args ) {
      */
 
     double sum = 0.0;
-    for( const auto& sched_well : args.schedule_wells ){
+    for( const auto* sched_well : args.schedule_wells ){
 
-        double eff_fac = efac( args.eff_factors, sched_well.name() );
-        sum += sched_well.production_rate( args.st, phase ) * eff_fac;
+        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        sum += sched_well->production_rate( args.st, phase ) * eff_fac;
     }
 
 
@@ -620,9 +620,9 @@ template< Opm::Phase phase >
 inline quantity injection_history( const fn_args& args ) {
 
     double sum = 0.0;
-    for( const auto& sched_well : args.schedule_wells ){
-        double eff_fac = efac( args.eff_factors, sched_well.name() );
-        sum += sched_well.injection_rate( args.st, phase ) * eff_fac;
+    for( const auto* sched_well : args.schedule_wells ){
+        double eff_fac = efac( args.eff_factors, sched_well->name() );
+        sum += sched_well->injection_rate( args.st, phase ) * eff_fac;
     }
 
 
@@ -632,9 +632,9 @@ inline quantity injection_history( const fn_args& args ) {
 inline quantity res_vol_production_target( const fn_args& args ) {
 
     double sum = 0.0;
-    for( const Opm::Well2& sched_well : args.schedule_wells )
-        if (sched_well.getProductionProperties().predictionMode)
-            sum += sched_well.getProductionProperties().ResVRate.get<double>();
+    for( const auto* sched_well : args.schedule_wells )
+        if (sched_well->getProductionProperties().predictionMode)
+            sum += sched_well->getProductionProperties().ResVRate.get<double>();
 
     return { sum, measure::rate };
 }
@@ -672,15 +672,15 @@ template < rt phase, bool outputProducer = true, bool outputInjector = true>
 inline quantity potential_rate( const fn_args& args ) {
     double sum = 0.0;
 
-    for( const auto& sched_well : args.schedule_wells ) {
-        const auto& name = sched_well.name();
+    for( const auto* sched_well : args.schedule_wells ) {
+        const auto& name = sched_well->name();
         if( args.wells.count( name ) == 0 ) continue;
 
-        if (sched_well.isInjector() && outputInjector) {
+        if (sched_well->isInjector() && outputInjector) {
 	    const auto v = args.wells.at(name).rates.get(phase, 0.0);
 	    sum += v;
 	}
-	else if (sched_well.isProducer() && outputProducer) {
+	else if (sched_well->isProducer() && outputProducer) {
 	    const auto v = args.wells.at(name).rates.get(phase, 0.0);
 	    sum += v;
 	}
@@ -1108,62 +1108,6 @@ static const std::unordered_map< std::string, Opm::UnitSystem::measure> block_un
   {"BOVIS"      , Opm::UnitSystem::measure::viscosity},
 };
 
-inline std::vector<Opm::Well2> find_wells( const Opm::Schedule& schedule,
-                                           const Opm::SummaryNode& node,
-                                           const int sim_step,
-                                           const Opm::out::RegionCache& regionCache ) {
-
-    const auto cat = node.category();
-
-    if ((cat == Opm::SummaryNode::Category::Well) ||
-        (cat == Opm::SummaryNode::Category::Connection) ||
-        (cat == Opm::SummaryNode::Category::Segment))
-    {
-        const auto& name = node.namedEntity();
-
-        if (schedule.hasWell(name, sim_step)) {
-            const auto& well = schedule.getWell2( name, sim_step );
-            return { well };
-        } else
-            return {};
-    }
-
-    if( cat == Opm::SummaryNode::Category::Group ) {
-        const auto& name = node.namedEntity();
-
-        if( !schedule.hasGroup( name ) ) return {};
-
-        return schedule.getChildWells2( name, sim_step);
-    }
-
-    if( cat == Opm::SummaryNode::Category::Field )
-        return schedule.getWells2(sim_step);
-
-    if( cat == Opm::SummaryNode::Category::Region ) {
-        std::vector<Opm::Well2> wells;
-
-        const auto region = node.number();
-
-        for ( const auto& connection : regionCache.connections( region ) ){
-            const auto& w_name = connection.first;
-            if (schedule.hasWell(w_name, sim_step)) {
-                const auto& well = schedule.getWell2( w_name, sim_step );
-
-                const auto& it = std::find_if( wells.begin(), wells.end(),
-                                               [&] ( const Opm::Well2& elem )
-                                               { return elem.name() == well.name(); });
-                if ( it == wells.end() )
-                    wells.push_back( well );
-            }
-        }
-
-        return wells;
-    }
-
-    return {};
-}
-
-
 bool need_wells(Opm::SummaryNode::Category cat, const std::string& keyword) {
     static const std::set<std::string> region_keywords{"ROIR", "RGIR", "RWIR", "ROPR", "RGPR", "RWPR", "ROIT", "RWIT", "RGIT", "ROPT", "RGPT", "RWPT"};
     if (cat == Opm::SummaryNode::Category::Well)
@@ -1231,16 +1175,51 @@ void eval_udq(const Opm::Schedule& schedule, std::size_t sim_step, Opm::SummaryS
     }
 }
 
-void updateValue(const Opm::SummaryNode& node, const double value, Opm::SummaryState& st)
+/*
+ * Updates of the SummaryState recorded by the summary evaluators, as pairs
+ * of SummaryState handle and value.  The evaluators only read the
+ * SummaryState, and the recorded updates are applied in order once
+ * evaluation is complete.  This allows evaluators to run concurrently, each
+ * group of evaluators recording to a separate StagedUpdates object.
+ */
+class StagedUpdates
+{
+public:
+    void update(const std::size_t handle, const double value)
+    {
+        this->updates_.emplace_back(handle, value);
+    }
+
+    void apply(Opm::SummaryState& st) const
+    {
+        for (const auto& upd : this->updates_)
+            st.update_value(upd.first, upd.second);
+    }
+
+    void clear()
+    {
+        this->updates_.clear();
+    }
+
+private:
+    std::vector<std::pair<std::size_t, double>> updates_{};
+};
+
+/*
+ * SummaryState handle of the value of a summary node.  Well and group
+ * values use the specialized handles, such that they are also available
+ * through SummaryState::get_well_var() and get_group_var().
+ */
+std::size_t nodeHandle(const Opm::SummaryNode& node, Opm::SummaryState& st)
 {
     if (node.category() == Opm::SummaryNode::Category::Well)
-        st.update_well_var(node.namedEntity(), node.keyword(), value);
+        return st.well_var_handle(node.namedEntity(), node.keyword());
 
     else if (node.category() == Opm::SummaryNode::Category::Group)
-        st.update_group_var(node.namedEntity(), node.keyword(), value);
+        return st.group_var_handle(node.namedEntity(), node.keyword());
 
     else
-        st.update(node.uniqueNodeKey(), value);
+        return st.handle(node.uniqueNodeKey());
 }
 
 /*
@@ -1259,59 +1238,188 @@ void updateValue(const Opm::SummaryNode& node, const double value, Opm::SummaryS
  * rates and accumulated values.
  *
  */
-struct EfficiencyFactor
+
+/*
+ * Wells, group membership and efficiency factors of one report step,
+ * resolved once and shared by all summary evaluators.  The wells are
+ * referenced by pointer into the Schedule; no Well2 objects are copied.
+ * The resolution is reused for as long as evaluation stays at the same
+ * report step of the same Schedule object, and no well or group of the
+ * Schedule has been replaced since (Schedule::modificationCount()).
+ */
+class ResolvedWells
 {
-    using Factor  = std::pair<std::string, double>;
-    using FacColl = std::vector<Factor>;
+public:
+    using WellList = std::vector<const Opm::Well2*>;
+    using FactorMap = std::unordered_map<std::string, double>;
+
+    void update(const Opm::Schedule& schedule, const int sim_step);
 
-    FacColl factors{};
+    const WellList& wells(const Opm::SummaryNode&      node,
+                          const Opm::out::RegionCache& regionCache,
+                          WellList&                    regionWells) const;
 
-    void setFactors(const Opm::SummaryNode&        node,
-                    const Opm::Schedule&           schedule,
-                    const std::vector<Opm::Well2>& schedule_wells,
-                    const int                      sim_step);
+    const FactorMap& efficiencyFactors(const Opm::SummaryNode& node,
+                                       const WellList&         schedule_wells) const;
+
+private:
+    const Opm::Schedule* schedule_{nullptr};
+    std::size_t modification_count_{0};
+    int sim_step_{-1};
+
+    WellList field_{};
+    std::unordered_map<std::string, WellList> well_{};
+    std::unordered_map<std::string, WellList> group_{};
+
+    // Well and group efficiency factors multiplied up to the FIELD group,
+    // and for each group's rates up to, but excluding, the group itself.
+    FactorMap fieldFactors_{};
+    std::unordered_map<std::string, FactorMap> groupRateFactors_{};
+
+    const WellList& childWells(const std::string& group_name);
+
+    double efficiencyFactor(const Opm::Well2& well, const std::string& stop_group) const;
 };
 
-void EfficiencyFactor::setFactors(const Opm::SummaryNode&        node,
-                                  const Opm::Schedule&           schedule,
-                                  const std::vector<Opm::Well2>& schedule_wells,
-                                  const int                      sim_step)
+void ResolvedWells::update(const Opm::Schedule& schedule, const int sim_step)
+{
+    if ((this->schedule_ == &schedule) && (this->sim_step_ == sim_step) &&
+        (this->modification_count_ == schedule.modificationCount()))
+        return;
+
+    this->schedule_ = &schedule;
+    this->modification_count_ = schedule.modificationCount();
+    this->sim_step_ = sim_step;
+
+    this->field_.clear();
+    this->well_.clear();
+    this->group_.clear();
+    this->fieldFactors_.clear();
+    this->groupRateFactors_.clear();
+
+    for (const auto& name : schedule.wellNames(sim_step)) {
+        const auto* well = std::addressof(schedule.getWell2(name, sim_step));
+
+        this->field_.push_back(well);
+        this->well_.emplace(name, WellList{ well });
+
+        if (well->hasBeenDefined(sim_step))
+            this->fieldFactors_.emplace(name, this->efficiencyFactor(*well, ""));
+    }
+
+    for (const auto& name : schedule.groupNames()) {
+        const auto& wells = this->childWells(name);
+
+        auto& factors = this->groupRateFactors_[name];
+        for (const auto* well : wells) {
+            if (well->hasBeenDefined(sim_step))
+                factors.emplace(well->name(), this->efficiencyFactor(*well, name));
+        }
+    }
+}
+
+const ResolvedWells::WellList&
+ResolvedWells::childWells(const std::string& group_name)
+{
+    auto pos = this->group_.find(group_name);
+    if (pos != this->group_.end())
+        return pos->second;
+
+    WellList wells;
+    if (this->schedule_->hasGroup(group_name, this->sim_step_))
+        wells = this->schedule_->getChildWells2Ptr(group_name, this->sim_step_);
+
+    return this->group_.emplace(group_name, std::move(wells)).first->second;
+}
+
+double ResolvedWells::efficiencyFactor(const Opm::Well2& well, const std::string& stop_group) const
+{
+    double eff_factor = well.getEfficiencyFactor();
+    const auto* group_ptr = std::addressof(this->schedule_->getGroup2(well.groupName(), this->sim_step_));
+
+    while(true){
+        if (group_ptr->name() == stop_group)
+            break;
+        eff_factor *= group_ptr->getGroupEfficiencyFactor();
+
+        if (group_ptr->name() == "FIELD")
+            break;
+        group_ptr = std::addressof( this->schedule_->getGroup2( group_ptr->parent(), this->sim_step_ ) );
+    }
+
+    return eff_factor;
+}
+
+const ResolvedWells::WellList&
+ResolvedWells::wells(const Opm::SummaryNode&      node,
+                     const Opm::out::RegionCache& regionCache,
+                     WellList&                    regionWells) const
+{
+    static const WellList no_wells{};
+
+    const auto cat = node.category();
+
+    if ((cat == Opm::SummaryNode::Category::Well) ||
+        (cat == Opm::SummaryNode::Category::Connection) ||
+        (cat == Opm::SummaryNode::Category::Segment))
+    {
+        auto pos = this->well_.find(node.namedEntity());
+        return (pos != this->well_.end()) ? pos->second : no_wells;
+    }
+
+    if( cat == Opm::SummaryNode::Category::Group ) {
+        auto pos = this->group_.find(node.namedEntity());
+        return (pos != this->group_.end()) ? pos->second : no_wells;
+    }
+
+    if( cat == Opm::SummaryNode::Category::Field )
+        return this->field_;
+
+    if( cat == Opm::SummaryNode::Category::Region ) {
+        regionWells.clear();
+
+        const auto region = node.number();
+
+        for ( const auto& connection : regionCache.connections( region ) ){
+            auto pos = this->well_.find(connection.first);
+            if (pos == this->well_.end())
+                continue;
+
+            const auto* well = pos->second.front();
+            if (std::find(regionWells.begin(), regionWells.end(), well) == regionWells.end())
+                regionWells.push_back( well );
+        }
+
+        return regionWells;
+    }
+
+    return no_wells;
+}
+
+const ResolvedWells::FactorMap&
+ResolvedWells::efficiencyFactors(const Opm::SummaryNode& node,
+                                 const WellList&         schedule_wells) const
 {
-    this->factors.clear();
+    static const FactorMap no_factors{};
 
-    if (schedule_wells.empty()) { return; }
+    if (schedule_wells.empty()) { return no_factors; }
 
     const auto cat = node.category();
     if(    cat != Opm::SummaryNode::Category::Group
         && cat != Opm::SummaryNode::Category::Field
         && cat != Opm::SummaryNode::Category::Region
            && (node.type() != Opm::SummaryNode::Type::Total))
-        return;
+        return no_factors;
 
     const bool is_group = (cat == Opm::SummaryNode::Category::Group);
     const bool is_rate = (node.type() != Opm::SummaryNode::Type::Total);
 
-    for( const auto& well : schedule_wells ) {
-        if (!well.hasBeenDefined(sim_step))
-            continue;
-
-        double eff_factor = well.getEfficiencyFactor();
-        const auto* group_ptr = std::addressof(schedule.getGroup2(well.groupName(), sim_step));
-
-        while(true){
-            if((   is_group
-                && is_rate
-                && group_ptr->name() == node.namedEntity() ))
-                break;
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
-
-            if (group_ptr->name() == "FIELD")
-                break;
-            group_ptr = std::addressof( schedule.getGroup2( group_ptr->parent(), sim_step ) );
-        }
-
-        this->factors.emplace_back( well.name(), eff_factor );
+    if (is_group && is_rate) {
+        auto pos = this->groupRateFactors_.find(node.namedEntity());
+        return (pos != this->groupRateFactors_.end()) ? pos->second : no_factors;
     }
+
+    return this->fieldFactors_;
 }
 
 namespace Evaluator {
@@ -1321,6 +1429,7 @@ namespace Evaluator {
         const Opm::Schedule& sched;
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
+        const ResolvedWells& wells;
     };
 
     struct SimulatorResults
@@ -1336,13 +1445,24 @@ namespace Evaluator {
     public:
         virtual ~Base() {}
 
-        virtual void update(const std::size_t       sim_step,
-                            const double            stepSize,
-                            const InputData&        input,
-                            const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+        // Calculates the value of the parameter.  Returns false if the
+        // parameter has no value at this time.
+        virtual bool evaluate(const std::size_t        sim_step,
+                              const double             stepSize,
+                              const InputData&         input,
+                              const SimulatorResults&  simRes,
+                              const Opm::SummaryState& st,
+                              double&                  value) const = 0;
+
+        // SummaryState handle at which the value is stored, or noHandle
+        // for parameters which are not evaluated here.
+        virtual std::size_t handle(Opm::SummaryState& st) const = 0;
+
+        static const std::size_t noHandle;
     };
 
+    const std::size_t Base::noHandle = std::numeric_limits<std::size_t>::max();
+
     class FunctionRelation : public Base
     {
     public:
@@ -1351,39 +1471,43 @@ namespace Evaluator {
             , fcn_ (std::move(fcn))
         {}
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        bool evaluate(const std::size_t        sim_step,
+                      const double             stepSize,
+                      const InputData&         input,
+                      const SimulatorResults&  simRes,
+                      const Opm::SummaryState& st,
+                      double&                  value) const override
         {
             const auto get_wells =
                 need_wells(this->node_.category(), this->node_.keyword());
 
-            const auto wells = get_wells
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<Opm::Well2>{};
+            ResolvedWells::WellList regionWells{};
+            const auto& wells = get_wells
+                ? input.wells.wells(this->node_, input.reg, regionWells)
+                : regionWells;
 
             if (get_wells && wells.empty())
                 // Parameter depends on well information, but no active
                 // wells apply at this sim_step.  Nothing to do.
-                return;
-
-            EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
+                return false;
 
             const fn_args args {
                 wells, stepSize, static_cast<int>(sim_step),
                 std::max(0, this->node_.number()),
                 st, simRes.wellSol, input.reg, input.grid,
-                std::move(efac.factors)
+                input.wells.efficiencyFactors(this->node_, wells)
             };
 
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            value = usys.from_si(prm.unit, prm.value);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return nodeHandle(this->node_, st);
         }
 
     private:
@@ -1400,19 +1524,26 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        bool evaluate(const std::size_t    /* sim_step */,
+                      const double         /* stepSize */,
+                      const InputData&        input,
+                      const SimulatorResults& simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                  value) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
-                return;
+                return false;
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            value = usys.from_si(this->m_, xPos->second);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return nodeHandle(this->node_, st);
         }
 
     private:
@@ -1434,27 +1565,34 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        bool evaluate(const std::size_t    /* sim_step */,
+                      const double         /* stepSize */,
+                      const InputData&        input,
+                      const SimulatorResults& simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                  value) const override
         {
             if (this->node_.number() < 0)
-                return;
+                return false;
 
             auto xPos = simRes.region.find(this->node_.keyword());
             if (xPos == simRes.region.end())
-                return;
+                return false;
 
             const auto ix = this->index();
             if (ix >= xPos->second.size())
-                return;
+                return false;
 
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            value = usys.from_si(this->m_, val);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return nodeHandle(this->node_, st);
         }
 
     private:
@@ -1476,20 +1614,27 @@ namespace Evaluator {
             , m_   (m)
         {}
 
-        void update(const std::size_t    /* sim_step */,
-                    const double         /* stepSize */,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        bool evaluate(const std::size_t    /* sim_step */,
+                      const double         /* stepSize */,
+                      const InputData&        input,
+                      const SimulatorResults& simRes,
+                      const Opm::SummaryState& /* st */,
+                      double&                  value) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword());
             if (xPos == simRes.single.end())
-                return;
+                return false;
 
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            value = usys.from_si(this->m_, val);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return nodeHandle(this->node_, st);
         }
 
     private:
@@ -1500,13 +1645,20 @@ namespace Evaluator {
     class UserDefinedValue : public Base
     {
     public:
-        void update(const std::size_t       /* sim_step */,
-                    const double            /* stepSize */,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+        bool evaluate(const std::size_t        /* sim_step */,
+                      const double             /* stepSize */,
+                      const InputData&         /* input */,
+                      const SimulatorResults&  /* simRes */,
+                      const Opm::SummaryState& /* st */,
+                      double&                  /* value */) const override
         {
             // No-op
+            return false;
+        }
+
+        std::size_t handle(Opm::SummaryState& /* st */) const override
+        {
+            return noHandle;
         }
     };
 
@@ -1517,18 +1669,25 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&           input,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        bool evaluate(const std::size_t       /* sim_step */,
+                      const double               stepSize,
+                      const InputData&           input,
+                      const SimulatorResults& /* simRes */,
+                      const Opm::SummaryState&   st,
+                      double&                    value) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
+            value = usys.from_si(m, val);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return st.handle(this->saveKey_);
         }
 
     private:
@@ -1542,17 +1701,24 @@ namespace Evaluator {
             : saveKey_(std::move(saveKey))
         {}
 
-        void update(const std::size_t       /* sim_step */,
-                    const double               stepSize,
-                    const InputData&        /* input */,
-                    const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+        bool evaluate(const std::size_t       /* sim_step */,
+                      const double               stepSize,
+                      const InputData&        /* input */,
+                      const SimulatorResults& /* simRes */,
+                      const Opm::SummaryState&   st,
+                      double&                    value) const override
         {
             using namespace ::Opm::unit;
 
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, year));
+            value = convert::to(val, year);
+            return true;
+        }
+
+        std::size_t handle(Opm::SummaryState& st) const override
+        {
+            return st.handle(this->saveKey_);
         }
 
     private:
@@ -1968,6 +2134,8 @@ public:
                                    const Schedule&      sched,
                                    const std::string&   basename);
 
+    ~SummaryImplementation();
+
     SummaryImplementation(const SummaryImplementation& rhs) = delete;
     SummaryImplementation(SummaryImplementation&& rhs) = default;
     SummaryImplementation& operator=(const SummaryImplementation& rhs) = delete;
@@ -1986,6 +2154,8 @@ public:
     void internal_store(const SummaryState& st, const int report_step);
     void write();
 
+    void set_eval_threads(const int num_threads);
+
 private:
     struct MiniStep
     {
@@ -1999,6 +2169,24 @@ private:
     std::reference_wrapper<const Opm::EclipseGrid> grid_;
     Opm::out::RegionCache regCache_;
 
+    // Serialises eval(), which updates the mutable evaluation state
+    // below.  Held through a pointer to keep the class movable.
+    std::unique_ptr<std::mutex> evalMutex_ = std::make_unique<std::mutex>();
+
+    // Wells resolved for the most recently evaluated report step.
+    mutable ResolvedWells wells_{};
+
+    // Number of threads evaluating summary parameters, and per-chunk
+    // updates recorded during evaluation.
+    int numThreads_{1};
+    mutable std::vector<StagedUpdates> staged_{};
+
+    // SummaryState handles of the evaluated parameters and of the stored
+    // values, resolved for the SummaryState with id handleInstance_.
+    mutable std::uint64_t handleInstance_{0};
+    mutable std::vector<std::size_t> evalHandles_{};
+    mutable std::vector<std::size_t> valueHandles_{};
+
     std::unique_ptr<SMSpecStreamDeferredCreation> deferredSMSpec_;
 
     Opm::EclIO::OutputStream::ResultSet rset_;
@@ -2028,6 +2216,8 @@ private:
     void configureRequiredRestartParameters(const SummaryConfig& sumcfg,
                                             const Schedule&      sched);
 
+    void resolveHandles(SummaryState& st) const;
+
     MiniStep& getNextMiniStep(const int report_step);
     const MiniStep& lastUnwritten() const;
 
@@ -2055,6 +2245,17 @@ SummaryImplementation(const EclipseState&  es,
     this->configureRequiredRestartParameters(sumcfg, sched);
 }
 
+Opm::out::Summary::SummaryImplementation::~SummaryImplementation()
+{
+    if (this->unif_.set && this->stream_) {
+        // Close stream before indexing complete unified summary file.
+        this->stream_.reset();
+
+        Opm::EclIO::OutputStream::
+            indexUnifiedSummaryFile(this->rset_, this->fmt_);
+    }
+}
+
 void Opm::out::Summary::SummaryImplementation::
 internal_store(const SummaryState& st, const int report_step)
 {
@@ -2062,10 +2263,22 @@ internal_store(const SummaryState& st, const int report_step)
 
     const auto nParam = this->valueKeys_.size();
 
+    if (st.instance_id() == this->handleInstance_) {
+        for (auto i = decltype(nParam){0}; i < nParam; ++i) {
+            const auto handle = this->valueHandles_[i];
+            if (! st.has_value(handle))
+                // Parameter not yet evaluated (e.g., well/group not
+                // yet active).  Nothing to do here.
+                continue;
+
+            ms.params[i] = st.get_value(handle);
+        }
+
+        return;
+    }
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
         if (! st.has(this->valueKeys_[i]))
-            // Parameter not yet evaluated (e.g., well/group not
-            // yet active).  Nothing to do here.
             continue;
 
         ms.params[i] = st.get(this->valueKeys_[i]);
@@ -2084,21 +2297,115 @@ eval(const EclipseState&            es,
      const BlockValues&             block_values,
      Opm::SummaryState&             st) const
 {
+    std::lock_guard<std::mutex> lock{ *this->evalMutex_ };
+
+    this->wells_.update(sched, sim_step);
+
+    if (st.instance_id() != this->handleInstance_)
+        this->resolveHandles(st);
+
     const Evaluator::InputData input {
-        es, sched, this->grid_, this->regCache_
+        es, sched, this->grid_, this->regCache_, this->wells_
     };
 
     const Evaluator::SimulatorResults simRes {
         well_solution, single_values, region_values, block_values
     };
 
-    for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    const auto& evaluators = this->outputParameters_.getEvaluators();
+    const auto& required   = this->requiredRestartParameters_;
+
+    const auto numEval = evaluators.size() + required.size();
+
+    if (this->numThreads_ == 1) {
+        // Serial evaluation.  Values are stored directly in 'st'.
+        for (auto i = 0*numEval; i < numEval; ++i) {
+            const auto& evalPtr = (i < evaluators.size())
+                ? evaluators[i] : required[i - evaluators.size()];
+
+            double value;
+            if (evalPtr->evaluate(sim_step, duration, input, simRes, st, value))
+                st.update_value(this->evalHandles_[i], value);
+        }
+
+        return;
     }
 
-    for (auto& evalPtr : this->requiredRestartParameters_) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+    // Evaluators are split into contiguous chunks, each chunk recording
+    // its updates separately.  Chunks are evaluated concurrently and the
+    // updates applied to 'st' in chunk order once all are complete.
+    const auto numChunks =
+        std::max(std::min(numEval, std::size_t(4 * this->numThreads_)), std::size_t{1});
+
+    this->staged_.resize(numChunks);
+
+    std::exception_ptr error{};
+
+#pragma omp parallel for num_threads(this->numThreads_) schedule(dynamic)
+    for (int chunk = 0; chunk < static_cast<int>(numChunks); ++chunk) {
+        auto& updates = this->staged_[chunk];
+        updates.clear();
+
+        const auto begin = (chunk + 0) * numEval / numChunks;
+        const auto end   = (chunk + 1) * numEval / numChunks;
+
+        try {
+            for (auto i = begin; i < end; ++i) {
+                const auto& evalPtr = (i < evaluators.size())
+                    ? evaluators[i] : required[i - evaluators.size()];
+
+                double value;
+                if (evalPtr->evaluate(sim_step, duration, input, simRes, st, value))
+                    updates.update(this->evalHandles_[i], value);
+            }
+        }
+        catch (...) {
+#pragma omp critical
+            if (! error)
+                error = std::current_exception();
+        }
     }
+
+    if (error)
+        std::rethrow_exception(error);
+
+    for (const auto& updates : this->staged_)
+        updates.apply(st);
+}
+
+void Opm::out::Summary::SummaryImplementation::
+resolveHandles(SummaryState& st) const
+{
+    const auto& evaluators = this->outputParameters_.getEvaluators();
+    const auto& required   = this->requiredRestartParameters_;
+
+    this->evalHandles_.clear();
+    this->evalHandles_.reserve(evaluators.size() + required.size());
+
+    for (const auto& evalPtr : evaluators)
+        this->evalHandles_.push_back(evalPtr->handle(st));
+
+    for (const auto& evalPtr : required)
+        this->evalHandles_.push_back(evalPtr->handle(st));
+
+    this->valueHandles_.clear();
+    this->valueHandles_.reserve(this->valueKeys_.size());
+
+    for (const auto& key : this->valueKeys_)
+        this->valueHandles_.push_back(st.handle(key));
+
+    this->handleInstance_ = st.instance_id();
+}
+
+void Opm::out::Summary::SummaryImplementation::set_eval_threads(const int num_threads)
+{
+    if (num_threads < 1)
+        throw std::invalid_argument {
+            "Number of summary evaluation threads must be positive, got "
+            + std::to_string(num_threads)
+        };
+
+    this->numThreads_ = num_threads;
 }
 
 void Opm::out::Summary::SummaryImplementation::write()
@@ -2387,6 +2694,11 @@ void Summary::write() const
     this->pImpl_->write();
 }
 
+void Summary::set_eval_threads(const int num_threads)
+{
+    this->pImpl_->set_eval_threads(num_threads);
+}
+
 Summary::~Summary() {}
 
 }} // namespace Opm::out
@@ -344,6 +344,8 @@ namespace {
         auto dz    = std::vector<float>{};  dz   .reserve(nAct);
         auto depth = std::vector<float>{};  depth.reserve(nAct);
 
+        grid.precomputeGeometry();
+
         for (auto cell = 0*nAct; cell < nAct; ++cell) {
             const auto  globCell = grid.getGlobalIndex(cell);
             const auto& dims     = grid.getCellDims(globCell);
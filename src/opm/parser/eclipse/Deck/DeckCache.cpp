@@ -0,0 +1,484 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
+#include <opm/parser/eclipse/Deck/DeckItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Deck/DeckRecord.hpp>
+#include <opm/parser/eclipse/Parser/ParseContext.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Units/Dimension.hpp>
+
+namespace Opm {
+
+namespace {
+
+const char cache_magic[8] = {'O', 'P', 'M', 'D', 'E', 'C', 'K', '\0'};
+const std::uint32_t cache_version = 1;
+
+/*
+  Fast non-cryptographic 64 bit hash; the input is consumed eight bytes at a
+  time, and a trailing partial word is zero padded. The value only depends on
+  the sequence of update() calls, which is all the cache needs.
+*/
+class Hasher {
+public:
+    void update(const char* data, std::size_t size) {
+        std::size_t offset = 0;
+        for (; offset + sizeof(std::uint64_t) <= size; offset += sizeof(std::uint64_t)) {
+            std::uint64_t word;
+            std::memcpy(&word, data + offset, sizeof word);
+            this->mix(word);
+        }
+
+        if (offset < size) {
+            std::uint64_t word = 0;
+            std::memcpy(&word, data + offset, size - offset);
+            this->mix(word);
+        }
+        this->length += size;
+    }
+
+    void update(std::uint64_t value) {
+        this->mix(value);
+    }
+
+    void update(const std::string& value) {
+        this->update(value.size());
+        this->update(value.data(), value.size());
+    }
+
+    std::uint64_t value() const {
+        auto h = this->state ^ this->length;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+private:
+    void mix(std::uint64_t word) {
+        this->state ^= word;
+        this->state *= 0x9e3779b97f4a7c15ULL;
+        this->state ^= this->state >> 29;
+    }
+
+    std::uint64_t state = 0xcbf29ce484222325ULL;
+    std::uint64_t length = 0;
+};
+
+
+std::uint64_t context_hash(const Parser& parser, const ParseContext& context) {
+    Hasher hasher;
+    hasher.update(parser.keywordDefinitions());
+    for (const auto& pair : context) {
+        hasher.update(pair.first);
+        hasher.update(static_cast<std::uint64_t>(pair.second));
+    }
+    return hasher.value();
+}
+
+
+class Writer {
+public:
+    explicit Writer(std::ostream& os_arg) :
+        os(os_arg)
+    {}
+
+    template <typename T>
+    void value(const T& x) {
+        this->os.write(reinterpret_cast<const char*>(&x), sizeof x);
+    }
+
+    void string(const std::string& s) {
+        this->value<std::uint64_t>(s.size());
+        this->os.write(s.data(), s.size());
+    }
+
+    template <typename T>
+    void array(const std::vector<T>& data) {
+        this->value<std::uint64_t>(data.size());
+        this->os.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(T));
+    }
+
+private:
+    std::ostream& os;
+};
+
+
+class Reader {
+public:
+    explicit Reader(std::istream& is_arg) :
+        is(is_arg)
+    {}
+
+    template <typename T>
+    T value() {
+        T x;
+        this->read(reinterpret_cast<char*>(&x), sizeof x);
+        return x;
+    }
+
+    std::string string() {
+        std::string s(this->value<std::uint64_t>(), '\0');
+        this->read(&s[0], s.size());
+        return s;
+    }
+
+    template <typename T>
+    void array(std::vector<T>& data) {
+        data.resize(this->value<std::uint64_t>());
+        this->read(reinterpret_cast<char*>(data.data()), data.size() * sizeof(T));
+    }
+
+private:
+    void read(char* data, std::size_t size) {
+        if (!this->is.read(data, size))
+            throw std::runtime_error("Unexpected end of deck cache file");
+    }
+
+    std::istream& is;
+};
+
+}
+
+
+
+class DeckCacheIO {
+public:
+    static void write(Writer& writer, const DeckKeyword& keyword);
+    static void write(Writer& writer, const DeckItem& item);
+    static void write(Writer& writer, const std::vector<Dimension>& dims);
+
+    static DeckKeyword readKeyword(Reader& reader, const ParserKeyword& parser_keyword, const std::string& name);
+    static DeckItem readItem(Reader& reader);
+    static std::vector<Dimension> readDimensions(Reader& reader);
+};
+
+
+void DeckCacheIO::write(Writer& writer, const std::vector<Dimension>& dims) {
+    writer.value<std::uint64_t>(dims.size());
+    for (const auto& dim : dims) {
+        writer.string(dim.m_name);
+        writer.value(dim.m_SIfactor);
+        writer.value(dim.m_SIoffset);
+    }
+}
+
+
+std::vector<Dimension> DeckCacheIO::readDimensions(Reader& reader) {
+    std::vector<Dimension> dims(reader.value<std::uint64_t>());
+    for (auto& dim : dims) {
+        dim.m_name = reader.string();
+        dim.m_SIfactor = reader.value<double>();
+        dim.m_SIoffset = reader.value<double>();
+    }
+    return dims;
+}
+
+
+void DeckCacheIO::write(Writer& writer, const DeckItem& item) {
+    item.load();
+
+    writer.string(item.item_name);
+    writer.value(static_cast<std::uint8_t>(item.type));
+    writer.value(static_cast<std::uint8_t>(item.raw_data));
+    write(writer, item.active_dimensions);
+    write(writer, item.default_dimensions);
+
+    writer.value<std::uint64_t>(item.defaulted.size());
+    for (bool defaulted : item.defaulted)
+        writer.value(static_cast<std::uint8_t>(defaulted));
+
+    switch (item.type) {
+    case type_tag::integer:
+        writer.array(item.ival);
+        break;
+    case type_tag::fdouble:
+        writer.array(item.dval);
+        break;
+    case type_tag::string:
+        writer.value<std::uint64_t>(item.sval.size());
+        for (const auto& s : item.sval)
+            writer.string(s);
+        break;
+    case type_tag::uda:
+        writer.value<std::uint64_t>(item.uval.size());
+        for (const auto& uda : item.uval) {
+            const bool numeric = uda.is<double>();
+            writer.value(static_cast<std::uint8_t>(numeric));
+            if (numeric)
+                writer.value(uda.get<double>());
+            else
+                writer.string(uda.get<std::string>());
+        }
+        break;
+    default:
+        throw std::logic_error("DeckCache: can not store item of unknown type: " + item.item_name);
+    }
+}
+
+
+DeckItem DeckCacheIO::readItem(Reader& reader) {
+    DeckItem item;
+    item.item_name = reader.string();
+    item.type = static_cast<type_tag>(reader.value<std::uint8_t>());
+    item.raw_data = reader.value<std::uint8_t>() != 0;
+    item.active_dimensions = readDimensions(reader);
+    item.default_dimensions = readDimensions(reader);
+
+    item.defaulted.resize(reader.value<std::uint64_t>());
+    for (std::size_t index = 0; index < item.defaulted.size(); index++)
+        item.defaulted[index] = reader.value<std::uint8_t>() != 0;
+
+    switch (item.type) {
+    case type_tag::integer:
+        reader.array(item.ival);
+        break;
+    case type_tag::fdouble:
+        reader.array(item.dval);
+        break;
+    case type_tag::string:
+        item.sval.resize(reader.value<std::uint64_t>());
+        for (auto& s : item.sval)
+            s = reader.string();
+        break;
+    case type_tag::uda:
+        item.uval.resize(reader.value<std::uint64_t>());
+        for (auto& uda : item.uval) {
+            if (reader.value<std::uint8_t>() != 0)
+                uda.reset(reader.value<double>());
+            else
+                uda.reset(reader.string());
+        }
+        break;
+    default:
+        throw std::runtime_error("DeckCache: invalid item type in cache file");
+    }
+
+    return item;
+}
+
+
+void DeckCacheIO::write(Writer& writer, const DeckKeyword& keyword) {
+    writer.string(keyword.m_keywordName);
+    writer.string(keyword.m_location.filename);
+    writer.value<std::uint64_t>(keyword.m_location.lineno);
+    writer.value(static_cast<std::uint8_t>(keyword.m_isDataKeyword));
+    writer.value(static_cast<std::uint8_t>(keyword.m_slashTerminated));
+
+    writer.value<std::uint64_t>(keyword.m_recordList.size());
+    for (const auto& record : keyword.m_recordList) {
+        writer.value<std::uint64_t>(record.size());
+        for (const auto& item : record)
+            write(writer, item);
+    }
+}
+
+
+DeckKeyword DeckCacheIO::readKeyword(Reader& reader, const ParserKeyword& parser_keyword, const std::string& name) {
+    auto filename = reader.string();
+    auto lineno = reader.value<std::uint64_t>();
+
+    DeckKeyword keyword(parser_keyword, Location(std::move(filename), lineno), name);
+    keyword.m_isDataKeyword = reader.value<std::uint8_t>() != 0;
+    keyword.m_slashTerminated = reader.value<std::uint8_t>() != 0;
+
+    const auto num_records = reader.value<std::uint64_t>();
+    keyword.m_recordList.reserve(num_records);
+    for (std::uint64_t record_index = 0; record_index < num_records; record_index++) {
+        std::vector<DeckItem> items(reader.value<std::uint64_t>());
+        for (auto& item : items)
+            item = readItem(reader);
+
+        keyword.m_recordList.emplace_back(std::move(items));
+    }
+
+    return keyword;
+}
+
+
+
+DeckCache::DeckCache(const std::string& directory_arg, const std::string& dataFile) :
+    directory(directory_arg)
+{
+    boost::filesystem::path data_path(dataFile);
+    try {
+        data_path = boost::filesystem::canonical(data_path);
+    } catch (const boost::filesystem::filesystem_error&) {
+        data_path = boost::filesystem::absolute(data_path);
+    }
+    this->data_file = data_path.string();
+
+    Hasher hasher;
+    hasher.update(this->data_file);
+    char hash_string[17];
+    std::snprintf(hash_string, sizeof hash_string, "%016llx", static_cast<unsigned long long>(hasher.value()));
+
+    const auto cache_name = data_path.stem().string() + "-" + hash_string + ".DECKCACHE";
+    this->file_name = (boost::filesystem::path(this->directory) / cache_name).string();
+}
+
+
+const std::string& DeckCache::fileName() const {
+    return this->file_name;
+}
+
+
+/*
+  Returns the hash of the file content, and the size of the file in the size
+  argument. If the file can not be read size is set to -1.
+*/
+std::uint64_t DeckCache::hashFile(const std::string& filename, std::int64_t& size) {
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr< std::FILE, decltype( closer ) > ufp(
+            std::fopen( filename.c_str(), "rb" ),
+            closer
+            );
+
+    Hasher hasher;
+    size = -1;
+    if (!ufp)
+        return hasher.value();
+
+    std::vector<char> buffer(1 << 22);
+    std::size_t total = 0;
+    while (true) {
+        const auto readc = std::fread(buffer.data(), 1, buffer.size(), ufp.get());
+        hasher.update(buffer.data(), readc);
+        total += readc;
+        if (readc < buffer.size())
+            break;
+    }
+
+    if (std::ferror(ufp.get()))
+        return hasher.value();
+
+    size = total;
+    return hasher.value();
+}
+
+
+bool DeckCache::load(const Parser& parser, const ParseContext& context, Deck& deck) const {
+    std::ifstream is(this->file_name, std::ios::binary);
+    if (!is)
+        return false;
+
+    try {
+        Reader reader(is);
+
+        char magic[sizeof cache_magic];
+        is.read(magic, sizeof magic);
+        if (!is || !std::equal(magic, magic + sizeof magic, cache_magic))
+            return false;
+
+        if (reader.value<std::uint32_t>() != cache_version)
+            return false;
+
+        if (reader.value<std::uint64_t>() != context_hash(parser, context))
+            return false;
+
+        if (reader.string() != this->data_file)
+            return false;
+
+        const auto num_files = reader.value<std::uint64_t>();
+        for (std::uint64_t file_index = 0; file_index < num_files; file_index++) {
+            const auto filename = reader.string();
+            const auto size = reader.value<std::int64_t>();
+            const auto hash = reader.value<std::uint64_t>();
+
+            std::int64_t current_size;
+            const auto current_hash = hashFile(filename, current_size);
+            if (current_size != size || current_hash != hash)
+                return false;
+        }
+
+        std::unordered_map<std::string, const ParserKeyword*> parser_keywords;
+        const auto num_keywords = reader.value<std::uint64_t>();
+        for (std::uint64_t keyword_index = 0; keyword_index < num_keywords; keyword_index++) {
+            const auto name = reader.string();
+            auto iter = parser_keywords.find(name);
+            if (iter == parser_keywords.end()) {
+                if (!parser.isRecognizedKeyword(name))
+                    return false;
+
+                iter = parser_keywords.emplace(name, &parser.getParserKeywordFromDeckName(name)).first;
+            }
+
+            deck.addKeyword(DeckCacheIO::readKeyword(reader, *iter->second, name));
+        }
+    } catch (const std::exception& e) {
+        OpmLog::warning("Ignoring deck cache file " + this->file_name + ": " + e.what());
+        return false;
+    }
+
+    return true;
+}
+
+
+void DeckCache::store(const Parser& parser, const ParseContext& context, const Deck& deck, const std::vector<std::string>& inputFiles) const {
+    const auto tmp_file = this->file_name + ".tmp";
+    try {
+        boost::filesystem::create_directories(this->directory);
+        {
+            std::ofstream os(tmp_file, std::ios::binary);
+            Writer writer(os);
+
+            os.write(cache_magic, sizeof cache_magic);
+            writer.value(cache_version);
+            writer.value(context_hash(parser, context));
+            writer.string(this->data_file);
+
+            writer.value<std::uint64_t>(inputFiles.size());
+            for (const auto& filename : inputFiles) {
+                std::int64_t size;
+                const auto hash = hashFile(filename, size);
+                writer.string(filename);
+                writer.value(size);
+                writer.value(hash);
+            }
+
+            writer.value<std::uint64_t>(deck.size());
+            for (const auto& keyword : deck)
+                DeckCacheIO::write(writer, keyword);
+
+            if (!os.flush())
+                throw std::runtime_error("Could not write " + tmp_file);
+        }
+        boost::filesystem::rename(tmp_file, this->file_name);
+    } catch (const std::exception& e) {
+        OpmLog::warning("Could not write deck cache file " + this->file_name + ": " + e.what());
+        boost::system::error_code ec;
+        boost::filesystem::remove(tmp_file, ec);
+    }
+}
+
+}
@@ -40,6 +40,7 @@ std::vector< T >& DeckItem::value_ref() {
 
 template<>
 const std::vector< int >& DeckItem::value_ref< int >() const {
+    this->load();
     if( this->type != get_type< int >() )
         throw std::invalid_argument( "DeckItem::value_ref<int> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
@@ -48,6 +49,7 @@ const std::vector< int >& DeckItem::value_ref< int >() const {
 
 template<>
 const std::vector< double >& DeckItem::value_ref< double >() const {
+    this->load();
     if (this->type == get_type<double>())
         return this->dval;
 
@@ -56,6 +58,7 @@ const std::vector< double >& DeckItem::value_ref< double >() const {
 
 template<>
 const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
+    this->load();
     if( this->type != get_type< std::string >() )
         throw std::invalid_argument( "DeckItem::value_ref<std::string> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
@@ -64,6 +67,7 @@ const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
 
 template<>
 const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
+    this->load();
     if( this->type != get_type< UDAValue >() )
         throw std::invalid_argument( "DeckItem::value_ref<UDAValue> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
@@ -105,10 +109,12 @@ const std::string& DeckItem::name() const {
 }
 
 bool DeckItem::defaultApplied( size_t index ) const {
+    this->load();
     return this->defaulted.at( index );
 }
 
 bool DeckItem::hasValue( size_t index ) const {
+    this->load();
     switch( this->type ) {
         case type_tag::integer: return this->ival.size() > index;
         case type_tag::fdouble: return this->dval.size() > index;
@@ -119,6 +125,7 @@ bool DeckItem::hasValue( size_t index ) const {
 }
 
 size_t DeckItem::size() const {
+    this->load();
     switch( this->type ) {
         case type_tag::integer: return this->ival.size();
         case type_tag::fdouble: return this->dval.size();
@@ -236,6 +243,7 @@ void DeckItem::push_backDefault( UDAValue x ) {
 
 
 void DeckItem::push_backDummyDefault() {
+    this->load();
     if( !this->defaulted.empty() )
         throw std::logic_error("Pseudo defaults can only be specified for empty items");
 
@@ -301,6 +309,80 @@ type_tag DeckItem::getType() const {
 }
 
 
+DeckItem::DeferredLoader::DeferredLoader( const DeferredLoader& other ) :
+    function( other.function ),
+    text( other.text ),
+    pending( other.pending.load() )
+{
+}
+
+
+DeckItem::DeferredLoader& DeckItem::DeferredLoader::operator=( const DeferredLoader& other ) {
+    this->function = other.function;
+    this->text = other.text;
+    this->pending = other.pending.load();
+    return *this;
+}
+
+
+DeckItem::DeferredLoader::DeferredLoader( DeferredLoader&& other ) noexcept :
+    function( std::move( other.function ) ),
+    text( std::move( other.text ) ),
+    pending( other.pending.load() )
+{
+}
+
+
+DeckItem::DeferredLoader& DeckItem::DeferredLoader::operator=( DeferredLoader&& other ) noexcept {
+    this->function = std::move( other.function );
+    this->text = std::move( other.text );
+    this->pending = other.pending.load();
+    return *this;
+}
+
+
+void DeckItem::setLoader( Loader item_loader, std::shared_ptr< const std::string > text ) {
+    this->loader.pending = static_cast< bool >( item_loader );
+    this->loader.function = std::move( item_loader );
+    this->loader.text = std::move( text );
+}
+
+
+bool DeckItem::loaded() const {
+    return !this->loader.pending.load( std::memory_order_acquire );
+}
+
+
+void DeckItem::load() const {
+    if( !this->loader.pending.load( std::memory_order_acquire ) )
+        return;
+
+    /*
+      Threads accessing the item concurrently wait for the first one to
+      load it. The loader fills a copy of the item without a loader, whose
+      push_back() calls do not lock, and the values are moved into place
+      when it is done. If loading fails the item is left as it was.
+    */
+    std::lock_guard< std::mutex > lock( this->loader.mutex );
+    if( !this->loader.pending.load( std::memory_order_relaxed ) )
+        return;
+
+    DeckItem values( *this );
+    values.loader = DeferredLoader();
+    this->loader.function( values );
+
+    auto& self = const_cast< DeckItem& >( *this );
+    self.dval = std::move( values.dval );
+    self.ival = std::move( values.ival );
+    self.sval = std::move( values.sval );
+    self.uval = std::move( values.uval );
+    self.defaulted = std::move( values.defaulted );
+
+    this->loader.function = nullptr;
+    this->loader.pending.store( false, std::memory_order_release );
+}
+
+
 
 template< typename T >
 void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) const {
@@ -314,6 +396,12 @@ void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) cons
 
 
 void DeckItem::write(DeckOutput& stream) const {
+    if( !this->loaded() && this->loader.text ) {
+        stream.write_raw( *this->loader.text );
+        return;
+    }
+
+    this->load();
     switch( this->type ) {
     case type_tag::integer:
         this->write_vector( stream, this->ival );
@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cctype>
 #include <ostream>
 
 #include <opm/parser/eclipse/Deck/DeckOutput.hpp>
@@ -53,6 +55,22 @@ namespace Opm {
     }
 
 
+    void DeckOutput::write_raw(const std::string& text) {
+        const auto is_space = [](char c) { return std::isspace(static_cast<unsigned char>(c)); };
+
+        auto token_begin = std::find_if_not(text.begin(), text.end(), is_space);
+        while (token_begin != text.end()) {
+            auto token_end = std::find_if(token_begin, text.end(), is_space);
+
+            write_sep( );
+            this->os.write(&(*token_begin), token_end - token_begin);
+            row_count++;
+
+            token_begin = std::find_if_not(token_end, text.end(), is_space);
+        }
+    }
+
+
     template <typename T>
     void DeckOutput::write( const T& value ) {
         if (default_count > 0) {
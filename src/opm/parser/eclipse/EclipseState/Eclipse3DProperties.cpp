@@ -80,6 +80,7 @@ namespace Opm {
                 const auto& ntg =  doubleGridProperties->getKeyword("NTG");
                 const auto& poroData = poro.getData();
                 const auto& ntg_data = ntg.getData();
+                eclipseGrid->precomputeGeometry();
                 for (size_t globalIndex = 0; globalIndex < poro.getCartesianSize(); globalIndex++) {
                     if (!std::isfinite(values[globalIndex])) {
                         double cell_poro = poroData[globalIndex];
@@ -56,7 +56,6 @@ namespace Opm {
         m_stride[2] = m_dims[0] * m_dims[1];
 
         m_isGlobal = true;
-        initIndexList();
     }
 
 
@@ -87,8 +86,6 @@ namespace Opm {
             m_isGlobal = true;
         else
             m_isGlobal = false;
-
-        initIndexList();
     }
 
 
@@ -113,15 +110,21 @@ namespace Opm {
 
 
     const std::vector<size_t>& Box::getIndexList() const {
+        if (!m_indexListValid)
+            initIndexList();
+
         return global_index_list;
     }
 
     const std::vector<Box::cell_index>& Box::index_list() const {
+        if (!m_indexListValid)
+            initIndexList();
+
         return m_index_list;
     }
 
 
-    void Box::initIndexList() {
+    void Box::initIndexList() const {
         global_index_list.clear();
         m_index_list.clear();
 
@@ -144,6 +147,7 @@ namespace Opm {
                 }
             }
         }
+        m_indexListValid = true;
     }
 
     bool Box::equal(const Box& other) const {
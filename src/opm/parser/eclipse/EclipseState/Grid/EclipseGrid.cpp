@@ -18,6 +18,7 @@
 */
 
 #define _USE_MATH_DEFINES
+#include <algorithm>
 #include <cmath>
 #include <numeric>
 
@@ -25,6 +26,10 @@
 #include <tuple>
 #include <functional>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/utility/numeric/calculateCellVol.hpp>
 
@@ -93,9 +98,6 @@ EclipseGrid::EclipseGrid(const std::string& fileName )
     initGridFromEGridFile(egridfile, fileName);
 
     resetACTNUM(m_actnum);
-
-    calculateGeometryData();
-
 }
 
 
@@ -156,7 +158,6 @@ EclipseGrid::EclipseGrid(size_t nx, size_t ny , size_t nz,
     }
 
     resetACTNUM();
-    calculateGeometryData();
 }
 
 EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std::vector<int>& actnum)
@@ -175,7 +176,7 @@ EclipseGrid::EclipseGrid(const EclipseGrid& src, const double* zcorn, const std:
         ZcornMapper mapper( getNX(), getNY(), getNZ());
         zcorn_fixed = mapper.fixupZCORN( m_zcorn );
 
-        calculateGeometryData();
+        resetGeometry();
     }
 
     resetACTNUM(actnum);
@@ -291,8 +292,6 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
             resetACTNUM();
         }
     }
-
-    calculateGeometryData();
 }
 
 
@@ -567,88 +566,198 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         zcorn_fixed = mapper.fixupZCORN( m_zcorn );
     }
 
-    void EclipseGrid::calculateGeometryData() {
+    EclipseGrid::GeometryCache::GeometryCache(const GeometryCache& other) {
+        *this = other;
+    }
 
-        const std::array<int, 3> dims = getNXYZ();
-        int nCells = getCartesianSize();
+    EclipseGrid::GeometryCache& EclipseGrid::GeometryCache::operator=(const GeometryCache& other) {
+        if (this == &other)
+            return *this;
 
-        std::array<double,8> X = {0.0};
-        std::array<double,8> Y = {0.0};
-        std::array<double,8> Z = {0.0};
+        std::lock(this->mutex, other.mutex);
+        std::lock_guard<std::mutex> lock(this->mutex, std::adopt_lock);
+        std::lock_guard<std::mutex> other_lock(other.mutex, std::adopt_lock);
 
-        m_volume.clear();
-        m_cellCenter.clear();
-        m_dx.clear();
-        m_dy.clear();
-        m_dz.clear();
-        m_depth.clear();
+        this->rows_per_block = other.rows_per_block;
+        this->num_blocks = other.num_blocks;
+        this->num_computed = other.num_computed;
+        this->computed.reset();
+        if (other.allocated.load()) {
+            this->computed.reset(new std::atomic<bool>[this->num_blocks]);
+            for (std::size_t block = 0; block < this->num_blocks; block++)
+                this->computed[block].store(other.computed[block].load());
+        }
 
-        m_volume.resize(nCells);
-        m_cellCenter.resize(nCells);
-        m_dx.resize(nCells);
-        m_dy.resize(nCells);
-        m_dz.resize(nCells);
-        m_depth.resize(nCells);
+        this->volume = other.volume;
+        this->depth = other.depth;
+        this->dx = other.dx;
+        this->dy = other.dy;
+        this->dz = other.dz;
+        this->centerX = other.centerX;
+        this->centerY = other.centerY;
+        this->centerZ = other.centerZ;
+        this->allocated.store(other.allocated.load());
+        this->complete.store(other.complete.load());
+        return *this;
+    }
 
-        std::array<int, 3> ijk;
-        size_t n = 0;
+    /*
+      Must be called when COORD or ZCORN have been changed, the geometry
+      is then calculated again when it is asked for.
+    */
+    void EclipseGrid::resetGeometry() {
+        m_geometry = GeometryCache();
+    }
 
-        for (size_t k = 0; k< getNZ(); k++) {
-            for (size_t j = 0; j< getNY(); j++) {
-                for (size_t i = 0; i< getNX(); i++) {
+    /*
+      Allocates the geometry arrays and the flags for the blocks; the
+      geometry mutex must be held by the caller.
+    */
+    void EclipseGrid::allocateGeometry() const {
+        auto& cache = m_geometry;
+        if (cache.allocated.load(std::memory_order_relaxed))
+            return;
 
-                    ijk[0] = i;
-                    ijk[1] = j;
-                    ijk[2] = k;
+        const std::size_t nCells = getCartesianSize();
+        const std::size_t nRows = getNY() * getNZ();
+        const std::size_t block_cells = 1 << 16;
 
-                    getCellCorners(ijk, dims, X, Y, Z );
+        cache.rows_per_block = std::max<std::size_t>(1, block_cells / std::max<std::size_t>(1, getNX()));
+        cache.num_blocks = (nRows + cache.rows_per_block - 1) / cache.rows_per_block;
+        cache.computed.reset(new std::atomic<bool>[cache.num_blocks]);
+        for (std::size_t block = 0; block < cache.num_blocks; block++)
+            cache.computed[block].store(false, std::memory_order_relaxed);
 
-                    m_volume[n] = calculateCellVol(X, Y, Z);
+        cache.volume.assign(nCells, 0);
+        cache.depth.assign(nCells, 0);
+        cache.dx.assign(nCells, 0);
+        cache.dy.assign(nCells, 0);
+        cache.dz.assign(nCells, 0);
+        cache.centerX.assign(nCells, 0);
+        cache.centerY.assign(nCells, 0);
+        cache.centerZ.assign(nCells, 0);
 
-                    std::array<double, 3> center;
+        cache.allocated.store(true, std::memory_order_release);
+    }
 
-                    center[0]=std::accumulate(X.begin(), X.end(), 0.0) / 8.0;
-                    center[1]=std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0;
-                    center[2]=std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0;
+    /*
+      Returns the geometry cache, after making sure that the block containing
+      the cell globalIndex has been calculated.
+    */
+    const EclipseGrid::GeometryCache& EclipseGrid::geometry(std::size_t globalIndex) const {
+        auto& cache = m_geometry;
+        if (cache.complete.load(std::memory_order_acquire))
+            return cache;
+
+        const std::size_t row = globalIndex / getNX();
+        if (cache.allocated.load(std::memory_order_acquire) &&
+            cache.computed[row / cache.rows_per_block].load(std::memory_order_acquire))
+            return cache;
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        allocateGeometry();
+
+        const std::size_t block = row / cache.rows_per_block;
+        if (!cache.computed[block].load(std::memory_order_relaxed)) {
+            calculateBlockGeometry(block);
+            cache.computed[block].store(true, std::memory_order_release);
+            cache.num_computed += 1;
+            if (cache.num_computed == cache.num_blocks)
+                cache.complete.store(true, std::memory_order_release);
+        }
 
-                    m_cellCenter[n] = center;
+        return cache;
+    }
 
-                    // calculate dx
+    void EclipseGrid::precomputeGeometry(int threads) const {
+        auto& cache = m_geometry;
+        if (cache.complete.load(std::memory_order_acquire))
+            return;
 
-                    double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
-                    double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        allocateGeometry();
 
-                    double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
-                    double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+#ifdef _OPENMP
+        const int num_threads = threads > 0 ? threads : omp_get_max_threads();
+#else
+        static_cast<void>(threads);
+#endif
 
-                    double dx = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0) );
+        const std::size_t num_blocks = cache.num_blocks;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (std::size_t block = 0; block < num_blocks; block++) {
+            if (!cache.computed[block].load(std::memory_order_relaxed)) {
+                calculateBlockGeometry(block);
+                cache.computed[block].store(true, std::memory_order_release);
+            }
+        }
 
-                    // calculate dy
+        cache.num_computed = num_blocks;
+        cache.complete.store(true, std::memory_order_release);
+    }
 
-                    x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
-                    y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+    void EclipseGrid::calculateBlockGeometry(std::size_t block) const {
+        const std::size_t nRows = getNY() * getNZ();
+        const std::size_t row_begin = block * m_geometry.rows_per_block;
+        const std::size_t row_end = std::min(nRows, row_begin + m_geometry.rows_per_block);
 
-                    x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
-                    y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+        for (std::size_t row = row_begin; row < row_end; row++)
+            calculateRowGeometry(row % getNY(), row / getNY());
+    }
+
+    /*
+      Calculates volume, center, dimensions and depth of the cells (0..nx-1,
+      j, k), and stores them in the geometry cache.
+    */
+    void EclipseGrid::calculateRowGeometry(std::size_t j, std::size_t k) const {
+        const std::array<int, 3> dims = getNXYZ();
 
-                    double dy = sqrt(pow((x2-x1), 2.0) + pow((y2-y1), 2.0));
+        std::array<double,8> X = {0.0};
+        std::array<double,8> Y = {0.0};
+        std::array<double,8> Z = {0.0};
 
-                    // calculate dz
+        std::array<int, 3> ijk = {{0, static_cast<int>(j), static_cast<int>(k)}};
+        std::size_t n = getGlobalIndex(0, j, k);
+        auto& cache = m_geometry;
 
-                    double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
-                    double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+        for (std::size_t i = 0; i < getNX(); i++, n++) {
+            ijk[0] = i;
 
-                    double dz = z2-z1;
+            getCellCorners(ijk, dims, X, Y, Z );
 
-                    m_dx[n] = dx;
-                    m_dy[n] = dy;
-                    m_dz[n] = dz;
+            cache.volume[n] = calculateCellVol(X, Y, Z);
 
-                    m_depth[n] =  (z2 + z1) / 2.0;
+            cache.centerX[n] = std::accumulate(X.begin(), X.end(), 0.0) / 8.0;
+            cache.centerY[n] = std::accumulate(Y.begin(), Y.end(), 0.0) / 8.0;
+            cache.centerZ[n] = std::accumulate(Z.begin(), Z.end(), 0.0) / 8.0;
 
-                    n++;
-                }
-            }
+            // calculate dx
+
+            double x2 = (X[1]+X[3]+X[5]+X[7])/4.0;
+            double y2 = (Y[1]+Y[3]+Y[5]+Y[7])/4.0;
+
+            double x1 = (X[0]+X[2]+X[4]+X[6])/4.0;
+            double y1 = (Y[0]+Y[2]+Y[4]+Y[6])/4.0;
+
+            cache.dx[n] = std::sqrt((x2-x1)*(x2-x1) + (y2-y1)*(y2-y1));
+
+            // calculate dy
+
+            x2 = (X[2]+X[3]+X[6]+X[7])/4.0;
+            y2 = (Y[2]+Y[3]+Y[6]+Y[7])/4.0;
+
+            x1 = (X[0]+X[1]+X[4]+X[5])/4.0;
+            y1 = (Y[0]+Y[1]+Y[4]+Y[5])/4.0;
+
+            cache.dy[n] = std::sqrt((x2-x1)*(x2-x1) + (y2-y1)*(y2-y1));
+
+            // calculate dz
+
+            const double z2 = (Z[4]+Z[5]+Z[6]+Z[7])/4.0;
+            const double z1 = (Z[0]+Z[1]+Z[2]+Z[3])/4.0;
+
+            cache.dz[n] = z2-z1;
+            cache.depth[n] = (z2 + z1) / 2.0;
         }
     }
 
@@ -1434,7 +1543,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
         assertGlobalIndex( globalIndex );
 
-        return m_volume[globalIndex];
+        return geometry(globalIndex).volume[globalIndex];
     }
 
     double EclipseGrid::getCellVolume(size_t i , size_t j , size_t k) const {
@@ -1458,13 +1567,14 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     double EclipseGrid::getCellThickness(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
 
-        return m_dz[globalIndex];
+        return geometry(globalIndex).dz[globalIndex];
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
 
-        return std::array<double,3> {{m_dx[globalIndex] , m_dy[globalIndex] , m_dz[globalIndex] }};
+        const auto& cache = geometry(globalIndex);
+        return std::array<double,3> {{cache.dx[globalIndex] , cache.dy[globalIndex] , cache.dz[globalIndex] }};
     }
 
     std::array<double, 3> EclipseGrid::getCellDims(size_t i , size_t j , size_t k) const {
@@ -1476,13 +1586,14 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
         }
     }
 
-    const std::array<double, 3>& EclipseGrid::getCellCenter(size_t globalIndex) const {
+    std::array<double, 3> EclipseGrid::getCellCenter(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
 
-        return m_cellCenter[globalIndex];
+        const auto& cache = geometry(globalIndex);
+        return std::array<double, 3> {{cache.centerX[globalIndex], cache.centerY[globalIndex], cache.centerZ[globalIndex]}};
     }
 
-    const std::array<double, 3>& EclipseGrid::getCellCenter(size_t i,size_t j, size_t k) const {
+    std::array<double, 3> EclipseGrid::getCellCenter(size_t i,size_t j, size_t k) const {
         assertIJK(i,j,k);
 
         const std::array<int, 3> dims = getNXYZ();
@@ -1533,7 +1644,7 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     double EclipseGrid::getCellDepth(size_t globalIndex) const {
         assertGlobalIndex( globalIndex );
 
-        return m_depth[globalIndex];
+        return geometry(globalIndex).depth[globalIndex];
     }
 
     double EclipseGrid::getCellDepth(size_t i, size_t j, size_t k) const {
@@ -1563,7 +1674,11 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
 
         ZcornMapper mapper( getNX(), getNY(), getNZ());
 
-        return mapper.fixupZCORN( m_zcorn );
+        const auto fixed = mapper.fixupZCORN( m_zcorn );
+        if (fixed > 0)
+            resetGeometry();
+
+        return fixed;
     }
 
     const std::vector<double>& EclipseGrid::getZCORN( ) const {
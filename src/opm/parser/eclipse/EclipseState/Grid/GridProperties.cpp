@@ -352,10 +352,8 @@ namespace Opm {
             double inputValue = record.getItem("VALUE").get<double>(0);
             int regionValue = record.getItem("REGION_NUMBER").get<int>(0);
             T targetValue = convertInputValue( targetProperty , inputValue );
-            std::vector<bool> mask;
 
-            regionProperty.initMask( regionValue , mask);
-            targetProperty.maskedSet( targetValue , mask);
+            targetProperty.maskedSet( targetValue , regionProperty.regionIndex( regionValue ));
         } else
             throw std::invalid_argument("Fatal error processing EQUALREG record - invalid/undefined keyword: " + targetArray);
     }
@@ -369,10 +367,8 @@ namespace Opm {
         double inputValue = record.getItem("SHIFT").get<double>(0);
         int regionValue = record.getItem("REGION_NUMBER").get<int>(0);
         T shiftValue = convertInputValue( targetProperty , inputValue );
-        std::vector<bool> mask;
 
-        regionProperty.initMask( regionValue , mask);
-        targetProperty.maskedAdd( shiftValue , mask);
+        targetProperty.maskedAdd( shiftValue , regionProperty.regionIndex( regionValue ));
     }
 
     template< typename T >
@@ -384,10 +380,8 @@ namespace Opm {
         double inputValue = record.getItem("FACTOR").get<double>(0);
         int regionValue = record.getItem("REGION_NUMBER").get<int>(0);
         T factor = convertInputValue( inputValue );
-        std::vector<bool> mask;
 
-        regionProperty.initMask( regionValue , mask);
-        targetProperty.maskedMultiply( factor , mask);
+        targetProperty.maskedMultiply( factor , regionProperty.regionIndex( regionValue ));
     }
 
     template< typename T >
@@ -403,12 +397,10 @@ namespace Opm {
 
         {
             int regionValue = record.getItem("REGION_NUMBER").get< int >(0);
-            std::vector<bool> mask;
             GridProperty<T>& targetProperty = getOrCreateProperty( targetArray );
             GridProperty<T>& srcProperty = getKeyword( srcArray );
 
-            regionProperty.initMask( regionValue , mask);
-            targetProperty.maskedCopy( srcProperty , mask );
+            targetProperty.maskedCopy( srcProperty , regionProperty.regionIndex( regionValue ));
         }
     }
 
@@ -433,15 +425,11 @@ namespace Opm {
                     result_prop.runPostProcessor();
             }
 
-            std::vector<T> targetData = result_prop.getData();
-            const std::vector<T>& srcData = getKeyword( srcArray ).getData();
+            const auto& src_prop = getKeyword( srcArray );
             Operate::function func = Operate::get( operation, alpha, beta );
 
             setKeywordBox(record, boxManager);
-            for (auto index : boxManager.getActiveBox().getIndexList())
-                targetData[index] = func( targetData[index] , srcData[index]);
-
-            result_prop.assignData(targetData);
+            result_prop.operate( func, src_prop, boxManager.getActiveBox() );
         }
     }
 
@@ -466,18 +454,10 @@ namespace Opm {
                     result_prop.runPostProcessor();
             }
 
-            std::vector<T> result_data = result_prop.getData();
-            const std::vector<T>& parameter_data = getKeyword( parameter_array ).getData();
+            const auto& parameter_prop = getKeyword( parameter_array );
             Operate::function func = Operate::get(operation, alpha, beta);
-            std::vector<bool> mask;
-
-            regionProperty.initMask(region_value, mask);
-            for (size_t index = 0; index < mask.size(); index++) {
-                if (mask[index])
-                    result_data[index] = func(result_data[index], parameter_data[index]);
-            }
 
-            result_prop.assignData(result_data);
+            result_prop.maskedOperate(func, parameter_prop, regionProperty.regionIndex(region_value));
         }
     }
 
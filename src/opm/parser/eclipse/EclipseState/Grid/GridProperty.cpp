@@ -174,11 +174,13 @@ namespace Opm {
     template< typename T >
     void GridProperty< T >::assignData(std::vector<T>&& data) {
         this->m_data = std::move(data);
+        this->clearRegionIndex();
     }
 
     template< typename T >
     void GridProperty< T >::assignData(const std::vector<T>& data) {
         this->m_data = data;
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -186,6 +188,7 @@ namespace Opm {
         if ((m_nx == other.m_nx) && (m_ny == other.m_ny) && (m_nz == other.m_nz)) {
             for (size_t g=0; g < m_data.size(); g++)
                 m_data[g] *= other.m_data[g];
+            this->clearRegionIndex();
         } else
             throw std::invalid_argument("Size mismatch between properties in mulitplyWith.");
     }
@@ -193,6 +196,7 @@ namespace Opm {
     template< typename T >
     void GridProperty< T >::multiplyValueAtIndex(size_t index, T factor) {
         m_data[index] *= factor;
+        this->clearRegionIndex();
     }
 
 
@@ -204,6 +208,7 @@ namespace Opm {
                 this->setElement(g, value);
         }
         this->assigned = true;
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -212,6 +217,7 @@ namespace Opm {
             if (mask[g])
                 m_data[g] *= value;
         }
+        this->clearRegionIndex();
     }
 
 
@@ -221,6 +227,7 @@ namespace Opm {
             if (mask[g])
                 m_data[g] += value;
         }
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -230,6 +237,101 @@ namespace Opm {
                 this->setElement(g, other.m_data[g], other.m_defaulted[g]);
         }
         this->assigned = other.deckAssigned();
+        this->clearRegionIndex();
+    }
+
+    /*
+      The index list may be the region index of this property, so the region
+      index is only cleared after the values have been updated.
+    */
+    template< typename T >
+    void GridProperty< T >::maskedSet( T value, const std::vector< size_t >& index_list ) {
+        for (const auto g : index_list)
+            this->setElement(g, value);
+        this->assigned = true;
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    void GridProperty< T >::maskedMultiply( T value, const std::vector< size_t >& index_list ) {
+        for (const auto g : index_list)
+            m_data[g] *= value;
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    void GridProperty< T >::maskedAdd( T value, const std::vector< size_t >& index_list ) {
+        for (const auto g : index_list)
+            m_data[g] += value;
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    void GridProperty< T >::maskedCopy( const GridProperty< T >& other, const std::vector< size_t >& index_list ) {
+        for (const auto g : index_list)
+            this->setElement(g, other.m_data[g], other.m_defaulted[g]);
+        this->assigned = other.deckAssigned();
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    void GridProperty< T >::maskedOperate( const std::function< double(double, double) >& func,
+                                           const GridProperty< T >& parameter,
+                                           const std::vector< size_t >& index_list ) {
+        for (const auto g : index_list)
+            m_data[g] = func(m_data[g], parameter.m_data[g]);
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    void GridProperty< T >::operate( const std::function< double(double, double) >& func,
+                                     const GridProperty< T >& parameter,
+                                     const Box& inputBox ) {
+        const auto& param = parameter.m_data;
+        inputBox.forEachIndex([&](size_t g) { m_data[g] = func(m_data[g], param[g]); });
+        this->clearRegionIndex();
+    }
+
+    template< typename T >
+    const std::vector< size_t >& GridProperty< T >::regionIndex( T value ) const {
+        if (!this->m_regionIndexValid) {
+            this->m_regionIndex.clear();
+
+            /*
+              Region properties mostly come in long runs of equal values, so
+              the hash lookup is only done when the value changes.
+            */
+            std::vector< size_t >* cells = nullptr;
+            T current = T();
+            for (size_t g = 0; g < m_data.size(); g++) {
+                const T cell_value = m_data[g];
+                if (cell_value != cell_value)
+                    continue;
+
+                if (!cells || cell_value != current) {
+                    cells = &this->m_regionIndex[cell_value];
+                    current = cell_value;
+                }
+                cells->push_back(g);
+            }
+            this->m_regionIndexValid = true;
+        }
+
+        static const std::vector< size_t > empty;
+        const auto iter = this->m_regionIndex.find(value);
+        if (iter == this->m_regionIndex.end())
+            return empty;
+
+        return iter->second;
+    }
+
+    template< typename T >
+    void GridProperty< T >::clearRegionIndex() {
+        if (!this->m_regionIndexValid)
+            return;
+
+        this->m_regionIndex.clear();
+        this->m_regionIndexValid = false;
     }
 
     template< typename T >
@@ -257,6 +359,7 @@ namespace Opm {
         }
 
         this->assigned = true;
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -265,21 +368,20 @@ namespace Opm {
             loadFromDeckKeyword( deckKeyword, multiply );
         else {
             const auto& deckItem = getDeckItem(deckKeyword);
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            if (indexList.size() == deckItem.size()) {
-                for (size_t sourceIdx = 0; sourceIdx < indexList.size(); sourceIdx++) {
-                    size_t targetIdx = indexList[sourceIdx];
-                    if (sourceIdx < deckItem.size()
-                        && !deckItem.defaultApplied(sourceIdx))
-                        {
+            if (inputBox.size() == deckItem.size()) {
+                size_t sourceIdx = 0;
+                inputBox.forEachIndex([&](size_t targetIdx) {
+                        if (!deckItem.defaultApplied(sourceIdx)) {
                             if (multiply)
                                 mulDataPoint(sourceIdx, targetIdx, deckItem);
                             else
                                 setDataPoint(sourceIdx, targetIdx, deckItem);
                         }
-                }
+                        sourceIdx++;
+                    });
+                this->clearRegionIndex();
             } else {
-                std::string boxSize = std::to_string(static_cast<long long>(indexList.size()));
+                std::string boxSize = std::to_string(static_cast<long long>(inputBox.size()));
                 std::string keywordSize = std::to_string(static_cast<long long>(deckItem.size()));
 
                 throw std::invalid_argument("Size mismatch: Box:" + boxSize + "  DeckKeyword:" + keywordSize);
@@ -293,9 +395,9 @@ namespace Opm {
             for (size_t i = 0; i < src.getCartesianSize(); ++i)
                 this->setElement(i, src.m_data[i], src.m_defaulted[i]);
         else
-            for (const auto& i : inputBox.getIndexList())
-                this->setElement(i, src.m_data[i], src.m_defaulted[i]);
+            inputBox.forEachIndex([&](size_t i) { this->setElement(i, src.m_data[i], src.m_defaulted[i]); });
         this->assigned = src.deckAssigned();
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -304,8 +406,8 @@ namespace Opm {
             for (size_t i = 0; i < m_data.size(); ++i)
                 this->setElement(i, std::min(value, this->m_data[i]));
         else
-            for (const auto& i : inputBox.getIndexList())
-                this->setElement(i, std::min(value, this->m_data[i]));
+            inputBox.forEachIndex([&](size_t i) { this->setElement(i, std::min(value, this->m_data[i])); });
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -314,8 +416,8 @@ namespace Opm {
             for (size_t i = 0; i < m_data.size(); ++i)
                 this->setElement(i, std::max(value, this->m_data[i]));
         else
-            for (const auto& i : inputBox.getIndexList())
-                this->setElement(i, std::max(value, this->m_data[i]));
+            inputBox.forEachIndex([&](size_t i) { this->setElement(i, std::max(value, this->m_data[i])); });
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -323,13 +425,9 @@ namespace Opm {
         if (inputBox.isGlobal()) {
             for (size_t i = 0; i < m_data.size(); ++i)
                 m_data[i] *= scaleFactor;
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] *= scaleFactor;
-            }
-        }
+        } else
+            inputBox.forEachIndex([&](size_t i) { m_data[i] *= scaleFactor; });
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -337,13 +435,9 @@ namespace Opm {
         if (inputBox.isGlobal()) {
             for (size_t i = 0; i < m_data.size(); ++i)
                 m_data[i] += shiftValue;
-        } else {
-            const std::vector<size_t>& indexList = inputBox.getIndexList();
-            for (size_t i = 0; i < indexList.size(); i++) {
-                size_t targetIndex = indexList[i];
-                m_data[targetIndex] += shiftValue;
-            }
-        }
+        } else
+            inputBox.forEachIndex([&](size_t i) { m_data[i] += shiftValue; });
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -352,9 +446,9 @@ namespace Opm {
             std::fill(m_data.begin(), m_data.end(), value);
             m_defaulted.assign(m_defaulted.size(), false);
         } else
-            for (const auto& i : inputBox.getIndexList())
-                this->setElement(i, value);
+            inputBox.forEachIndex([&](size_t i) { this->setElement(i, value); });
         this->assigned = true;
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -373,6 +467,7 @@ namespace Opm {
         if( this->m_hasRunPostProcessor ) return;
         this->m_hasRunPostProcessor = true;
         this->m_kwInfo.postProcessor()( m_defaulted, m_data );
+        this->clearRegionIndex();
     }
 
     template< typename T >
@@ -519,6 +614,7 @@ std::vector< double > temperature_lookup( size_t size,
         const auto& rtempvdTables = tables->getRtempvdTables();
         std::vector< double > values( size, 0 );
 
+        grid->precomputeGeometry();
         for (size_t cellIdx = 0; cellIdx < eqlNum.size(); ++ cellIdx) {
             int cellEquilRegionIdx = eqlNum[cellIdx] - 1; // EQLNUM contains fortran-style indices!
             const RtempvdTable& rtempvdTable = rtempvdTables.getTable<RtempvdTable>(cellEquilRegionIdx);
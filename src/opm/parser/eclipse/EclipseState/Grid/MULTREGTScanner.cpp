@@ -16,6 +16,8 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <algorithm>
+#include <cstddef>
 #include <stdexcept>
 #include <map>
 #include <set>
@@ -98,8 +100,7 @@ namespace Opm {
       interface with the wanted region values.
     */
     MULTREGTScanner::MULTREGTScanner(const Eclipse3DProperties& e3DProps,
-                                     const std::vector< const DeckKeyword* >& keywords) :
-                m_e3DProps(e3DProps) {
+                                     const std::vector< const DeckKeyword* >& keywords) {
 
         for (size_t idx = 0; idx < keywords.size(); idx++)
             this->addKeyword(e3DProps, *keywords[idx] , e3DProps.getDefaultRegionKeyword());
@@ -126,15 +127,74 @@ namespace Opm {
                                 + " which is not in the deck");
         }
 
+        std::map<std::string , MULTREGTSearchMap> searchMap;
         for (auto iter = searchPairs.begin(); iter != searchPairs.end(); ++iter) {
             const MULTREGTRecord * record = (*iter).second;
             std::pair<int,int> pair = (*iter).first;
             const std::string& keyword = record->region_name;
-            if (m_searchMap.count(keyword) == 0)
-                m_searchMap[keyword] = MULTREGTSearchMap();
+            if (searchMap.count(keyword) == 0)
+                searchMap[keyword] = MULTREGTSearchMap();
 
-            m_searchMap[keyword][pair] = record;
+            searchMap[keyword][pair] = record;
         }
+
+        for (const auto& pair : searchMap)
+            this->addSearchTable(e3DProps, pair.first, pair.second);
+    }
+
+
+    void MULTREGTScanner::addSearchTable( const Eclipse3DProperties& props, const std::string& region_name, const MULTREGTSearchMap& searchMap) {
+        // Largest number of elements in the dense (region1, region2) matrix.
+        const size_t max_dense_size = 1 << 20;
+
+        const auto& region = props.getIntGridProperty( region_name );
+        this->m_nx = region.getNX();
+        this->m_ny = region.getNY();
+
+        SearchTable table;
+        table.region_data = &region.getData();
+        table.min_region = searchMap.begin()->first.first;
+        int max_region = table.min_region;
+        for (const auto& pair : searchMap) {
+            table.min_region = std::min(table.min_region, std::min(pair.first.first, pair.first.second));
+            max_region = std::max(max_region, std::max(pair.first.first, pair.first.second));
+        }
+
+        const size_t num_regions = static_cast<size_t>(max_region) - table.min_region + 1;
+        if (num_regions * num_regions <= max_dense_size) {
+            table.num_regions = num_regions;
+            table.dense.assign(num_regions * num_regions, -1);
+            for (const auto& pair : searchMap) {
+                size_t index = (pair.first.first - table.min_region) * num_regions + (pair.first.second - table.min_region);
+                table.dense[index] = static_cast<int>(pair.second - m_records.data());
+            }
+        } else {
+            table.num_regions = 0;
+            for (const auto& pair : searchMap)
+                table.sparse.emplace_back(pair.first, static_cast<int>(pair.second - m_records.data()));
+        }
+
+        this->m_searchTables.push_back(std::move(table));
+    }
+
+
+    int MULTREGTScanner::SearchTable::find(int region1, int region2) const {
+        if (this->num_regions > 0) {
+            int i1 = region1 - this->min_region;
+            int i2 = region2 - this->min_region;
+            if (i1 < 0 || i1 >= this->num_regions || i2 < 0 || i2 >= this->num_regions)
+                return -1;
+
+            return this->dense[i1 * this->num_regions + i2];
+        }
+
+        const std::pair<int,int> key{ region1, region2 };
+        auto iter = std::lower_bound(this->sparse.begin(), this->sparse.end(), key,
+                                     [](const std::pair<std::pair<int,int>, int>& elm, const std::pair<int,int>& k) { return elm.first < k; });
+        if (iter == this->sparse.end() || iter->first != key)
+            return -1;
+
+        return iter->second;
     }
 
 
@@ -221,27 +281,25 @@ namespace Opm {
     */
     double MULTREGTScanner::getRegionMultiplier(size_t globalIndex1 , size_t globalIndex2, FaceDir::DirEnum faceDir) const {
 
-        for (auto iter = m_searchMap.begin(); iter != m_searchMap.end(); iter++) {
-            const Opm::GridProperty<int>& region = m_e3DProps.getIntGridProperty( (*iter).first );
-            const MULTREGTSearchMap& map = (*iter).second;
-            const auto& region_data = region.getData();
+        for (const auto& table : this->m_searchTables) {
+            const auto& region_data = *table.region_data;
 
             int regionId1 = region_data[globalIndex1];
             int regionId2 = region_data[globalIndex2];
 
-            std::pair<int,int> pair{ regionId1, regionId2 };
-            if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir)) {
-                pair = std::pair<int,int>{regionId2 , regionId1};
-                if (map.count(pair) != 1 || !(map.at(pair)->directions & faceDir))
+            int record_index = table.find(regionId1, regionId2);
+            if (record_index < 0 || !(m_records[record_index].directions & faceDir)) {
+                record_index = table.find(regionId2, regionId1);
+                if (record_index < 0 || !(m_records[record_index].directions & faceDir))
                     continue;
             }
-            const MULTREGTRecord* record = map.at(pair);
+            const MULTREGTRecord* record = &m_records[record_index];
 
             bool applyMultiplier = true;
-            int i1 = globalIndex1 % region.getNX();
-            int i2 = globalIndex2 % region.getNX();
-            int j1 = globalIndex1 / region.getNX() % region.getNY();
-            int j2 = globalIndex2 / region.getNX() % region.getNY();
+            int i1 = globalIndex1 % m_nx;
+            int i2 = globalIndex2 % m_nx;
+            int j1 = globalIndex1 / m_nx % m_ny;
+            int j2 = globalIndex2 / m_nx % m_ny;
 
             if (record->nnc_behaviour == MULTREGT::NNC){
                 applyMultiplier = true;
@@ -260,4 +318,20 @@ namespace Opm {
         }
         return 1;
     }
+
+
+    void MULTREGTScanner::getRegionMultipliers(const std::vector< MULTREGTFace >& faces, std::vector< double >& multipliers) const {
+        multipliers.resize(faces.size());
+        if (this->m_searchTables.empty()) {
+            std::fill(multipliers.begin(), multipliers.end(), 1.0);
+            return;
+        }
+
+        const std::ptrdiff_t num_faces = faces.size();
+#pragma omp parallel for schedule(static)
+        for (std::ptrdiff_t index = 0; index < num_faces; index++) {
+            const auto& face = faces[index];
+            multipliers[index] = this->getRegionMultiplier(face.global_index1, face.global_index2, face.face_dir);
+        }
+    }
 }
@@ -763,6 +763,7 @@ namespace Opm {
         const auto& endnum_data = endnum.getData();
 
         const auto gridsize = eclipseGrid->getCartesianSize();
+        eclipseGrid->precomputeGeometry();
         for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ ) {
             int satTableIdx = satnum_data[cellIdx] - 1;
             int endNum = endnum_data[cellIdx] - 1;
@@ -828,6 +829,7 @@ namespace Opm {
         const auto gridsize = eclipseGrid->getCartesianSize();
         const auto& imbnum_data = imbnum.getData();
         const auto& endnum_data = endnum.getData();
+        eclipseGrid->precomputeGeometry();
         for( size_t cellIdx = 0; cellIdx < gridsize; cellIdx++ ) {
             int imbTableIdx = imbnum_data[ cellIdx ] - 1;
             int endNum = endnum_data[ cellIdx ] - 1;
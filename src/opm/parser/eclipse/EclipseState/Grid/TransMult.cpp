@@ -95,6 +95,10 @@ R"(This deck has the MULTREGT keyword located in the EDIT section. Note that:
         return m_multregtScanner.getRegionMultiplier(globalCellIndex1, globalCellIndex2, faceDir);
     }
 
+    void TransMult::getRegionMultipliers(const std::vector< MULTREGTFace >& faces, std::vector< double >& multipliers) const {
+        m_multregtScanner.getRegionMultipliers(faces, multipliers);
+    }
+
     bool TransMult::hasDirectionProperty(FaceDir::DirEnum faceDir) const {
         return m_trans.count(faceDir) == 1;
     }
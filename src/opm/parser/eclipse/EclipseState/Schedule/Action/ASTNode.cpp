@@ -17,9 +17,10 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <fnmatch.h>
+#include <stdexcept>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/Action/ActionContext.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 
 #include "ASTNode.hpp"
 #include "ActionValue.hpp"
@@ -93,9 +94,9 @@ Action::Value ASTNode::value(const Action::Context& context) const {
         */
         if ((this->arg_list.size() == 1) && (arg_list[0].find("*") != std::string::npos)) {
             Action::Value well_values;
-            int fnmatch_flags = 0;
+            NamePattern pattern(this->arg_list[0]);
             for (const auto& well : context.wells(this->func)) {
-                if (fnmatch(this->arg_list[0].c_str(), well.c_str(), fnmatch_flags) == 0)
+                if (pattern.match(well))
                     well_values.add_well(well, context.get(this->func, well));
             }
             return well_values;
@@ -16,6 +16,8 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
+#include <stdexcept>
+
 #include <opm/parser/eclipse/EclipseState/Schedule/OilVaporizationProperties.hpp>
 
 namespace Opm {
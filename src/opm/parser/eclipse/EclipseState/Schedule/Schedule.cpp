@@ -17,8 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <fnmatch.h>
 #include <string>
+#include <utility>
 #include <vector>
 #include <stdexcept>
 #include <iostream>
@@ -73,12 +73,6 @@ namespace Opm {
 
 namespace {
 
-    bool name_match(const std::string& pattern, const std::string& name) {
-        int flags = 0;
-        return (fnmatch(pattern.c_str(), name.c_str(), flags) == 0);
-    }
-
-
     /*
       The function trim_wgname() is used to trim the leading and trailing spaces
       away from the group and well arguments given in the WELSPECS and GRUPTREE
@@ -599,6 +593,19 @@ namespace {
             return nullptr;
         };
 
+        /*
+          The COMPORD well name patterns are compiled once and matched
+          against all the new wells of this WELSPECS keyword.
+        */
+        std::vector<std::pair<NamePattern, std::string>> connection_order;
+        if( const auto* compordp = COMPORD_in_timestep() ) {
+            for (const auto& compordRecord : *compordp) {
+                const std::string& wellNamePattern = compordRecord.getItem(0).getTrimmedString(0);
+                const std::string& compordString = compordRecord.getItem(1).getTrimmedString(0);
+                connection_order.emplace_back(NamePattern(wellNamePattern), compordString);
+            }
+        }
+
         const auto& keyword = section.getKeyword( index );
 
         for (size_t recordNr = 0; recordNr < keyword.size(); recordNr++) {
@@ -612,18 +619,9 @@ namespace {
             if (!hasWell(wellName)) {
                 auto wellConnectionOrder = Connection::Order::TRACK;
 
-                if( const auto* compordp = COMPORD_in_timestep() ) {
-                     const auto& compord = *compordp;
-
-                    for (size_t compordRecordNr = 0; compordRecordNr < compord.size(); compordRecordNr++) {
-                        const auto& compordRecord = compord.getRecord(compordRecordNr);
-
-                        const std::string& wellNamePattern = compordRecord.getItem(0).getTrimmedString(0);
-                        if (Well2::wellNameInWellNamePattern(wellName, wellNamePattern)) {
-                            const std::string& compordString = compordRecord.getItem(1).getTrimmedString(0);
-                            wellConnectionOrder = Connection::OrderFromString(compordString);
-                        }
-                    }
+                for (const auto& pattern_order : connection_order) {
+                    if (pattern_order.first.match(wellName))
+                        wellConnectionOrder = Connection::OrderFromString(pattern_order.second);
                 }
                 this->addWell(wellName, record, currentStep, wellConnectionOrder, unit_system);
                 this->addWellToGroup(groupName, wellName, currentStep);
@@ -838,6 +836,7 @@ namespace {
     void Schedule::updateWell(std::shared_ptr<Well2> well, size_t reportStep) {
         auto& dynamic_state = this->wells_static.at(well->name());
         dynamic_state.update(reportStep, well);
+        this->wellsModified();
     }
 
 
@@ -2047,6 +2046,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         }
         {
             wells_static.insert( std::make_pair(wellName, DynamicState<std::shared_ptr<Well2>>(m_timeMap, nullptr)));
+            this->well_index.add(wellName);
 
             auto& dynamic_state = wells_static.at(wellName);
             const std::string& group = record.getItem<ParserKeywords::WELSPECS::GROUP>().getTrimmedString(0);
@@ -2068,6 +2068,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
             well_ptr->updateDrainageRadius(drainageRadius);
 
             dynamic_state.update(timeStep, well_ptr);
+            this->wellsModified();
         }
         m_events.addEvent( ScheduleEvents::NEW_WELL , timeStep );
         well_events.insert( std::make_pair(wellName, Events(this->m_timeMap)));
@@ -2112,41 +2113,97 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
 
 
     std::vector< Well2 > Schedule::getChildWells2(const std::string& group_name, size_t timeStep) const {
+        std::vector<Well2> wells;
+        for (const auto* well : this->getChildWells2Ptr(group_name, timeStep))
+            wells.push_back(*well);
+
+        return wells;
+    }
+
+
+    const std::vector<const Well2*>& Schedule::getChildWells2Ptr(const std::string& group_name, size_t timeStep) const {
         if (!hasGroup(group_name))
             throw std::invalid_argument("No such group: '" + group_name + "'");
+
+        std::lock_guard<std::mutex> lock(this->child_wells_cache.mutex);
+        return this->childWells(group_name, timeStep);
+    }
+
+
+    /*
+      The caller must hold child_wells_cache.mutex. The returned reference
+      stays valid until the cache is cleared; a range is only extended or
+      moved to a new first step, the list itself is never reallocated.
+    */
+    const std::vector<const Well2*>& Schedule::childWells(const std::string& group_name, size_t timeStep) const {
         {
-            const auto& dynamic_state = this->groups.at(group_name);
-            const auto& group_ptr = dynamic_state.get(timeStep);
-            if (group_ptr) {
-                std::vector<Well2> wells;
+            const auto& ranges = this->child_wells_cache.wells[group_name];
+            auto next = ranges.upper_bound(timeStep);
+            if (next != ranges.begin()) {
+                const auto& range = std::prev(next)->second;
+                if (timeStep <= range.last_step)
+                    return *range.wells;
+            }
+        }
 
-                if (group_ptr->groups().size()) {
-                    for (const auto& child_name : group_ptr->groups()) {
-                        const auto& child_wells = getChildWells2( child_name, timeStep);
-                        wells.insert( wells.end() , child_wells.begin() , child_wells.end());
-                    }
-                } else {
-                    for (const auto& well_name : group_ptr->wells( ))
-                        wells.push_back( this->getWell2( well_name, timeStep ));
+        std::vector<const Well2*> wells;
+        const auto& dynamic_state = this->groups.at(group_name);
+        const auto& group_ptr = dynamic_state.get(timeStep);
+        if (group_ptr) {
+            if (group_ptr->groups().size()) {
+                for (const auto& child_name : group_ptr->groups()) {
+                    const auto& child_wells = this->childWells( child_name, timeStep);
+                    wells.insert( wells.end() , child_wells.begin() , child_wells.end());
                 }
+            } else {
+                for (const auto& well_name : group_ptr->wells( ))
+                    wells.push_back( std::addressof(this->getWell2( well_name, timeStep )));
+            }
+        }
 
-                return wells;
-            } else
-                return {};
+        /*
+          Share the list with a neighbouring report step if the wells are
+          unchanged, otherwise start a new range.
+        */
+        auto& ranges = this->child_wells_cache.wells[group_name];
+        auto next = ranges.upper_bound(timeStep);
+        if (next != ranges.begin()) {
+            auto& prev = std::prev(next)->second;
+            if (prev.last_step + 1 == timeStep && *prev.wells == wells) {
+                prev.last_step = timeStep;
+                return *prev.wells;
+            }
         }
-    }
 
+        if (next != ranges.end() && next->first == timeStep + 1 && *next->second.wells == wells) {
+            ChildWellsCache::Range range{ next->second.last_step, std::move(next->second.wells) };
+            ranges.erase(next);
+            return *ranges.emplace(timeStep, std::move(range)).first->second.wells;
+        }
+
+        ChildWellsCache::Range range{ timeStep, std::unique_ptr<const std::vector<const Well2*>>(new std::vector<const Well2*>(std::move(wells))) };
+        return *ranges.emplace(timeStep, std::move(range)).first->second.wells;
+    }
 
 
     std::vector<Well2> Schedule::getWells2(size_t timeStep) const {
         std::vector<Well2> wells;
+        for (const auto* well : this->getWells2Ptr(timeStep))
+            wells.push_back(*well);
+
+        return wells;
+    }
+
+
+    std::vector<const Well2*> Schedule::getWells2Ptr(size_t timeStep) const {
+        std::vector<const Well2*> wells;
         if (timeStep >= this->m_timeMap.size())
             throw std::invalid_argument("timeStep argument beyond the length of the simulation");
 
         for (const auto& dynamic_pair : this->wells_static) {
             auto& well_ptr = dynamic_pair.second.get(timeStep);
             if (well_ptr)
-                wells.push_back(*well_ptr.get());
+                wells.push_back(well_ptr.get());
         }
         return wells;
     }
@@ -2155,6 +2212,10 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         return this->getWells2(this->m_timeMap.size() - 1);
     }
 
+    std::vector<const Well2*> Schedule::getWells2atEndPtr() const {
+        return this->getWells2Ptr(this->m_timeMap.size() - 1);
+    }
+
 
     const Well2& Schedule::getWell2atEnd(const std::string& well_name) const {
         return this->getWell2(well_name, this->m_timeMap.size() - 1);
@@ -2187,6 +2248,7 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
     void Schedule::updateGroup(std::shared_ptr<Group2> group, size_t reportStep) {
         auto& dynamic_state = this->groups.at(group->name());
         dynamic_state.update(reportStep, std::move(group));
+        this->wellsModified();
     }
 
     /*
@@ -2222,12 +2284,11 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
             std::vector<std::string> names;
-            for (const auto& well_pair : this->wells_static) {
-                if (name_match(pattern, well_pair.first)) {
-                    const auto& dynamic_state = well_pair.second;
-                    if (dynamic_state.get(timeStep))
-                        names.push_back(well_pair.first);
-                }
+            for (const auto index : this->well_index.match(pattern)) {
+                const auto& well_pair = *std::next(this->wells_static.begin(), index);
+                const auto& dynamic_state = well_pair.second;
+                if (dynamic_state.get(timeStep))
+                    names.push_back(well_pair.first);
             }
             return names;
         }
@@ -2277,13 +2338,12 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
             std::vector<std::string> names;
-            for (const auto& group_pair : this->groups) {
-                if (name_match(pattern, group_pair.first)) {
-                    const auto& dynamic_state = group_pair.second;
-                    const auto& group_ptr = dynamic_state.get(timeStep);
-                    if (group_ptr)
-                        names.push_back(group_pair.first);
-                }
+            for (const auto index : this->group_index.match(pattern)) {
+                const auto& group_pair = *std::next(this->groups.begin(), index);
+                const auto& dynamic_state = group_pair.second;
+                const auto& group_ptr = dynamic_state.get(timeStep);
+                if (group_ptr)
+                    names.push_back(group_pair.first);
             }
             return names;
         }
@@ -2316,12 +2376,10 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
-            int flags = 0;
             std::vector<std::string> names;
-            for (const auto& group_pair : this->groups) {
-                if (fnmatch(pattern.c_str(), group_pair.first.c_str(), flags) == 0)
-                    names.push_back(group_pair.first);
-            }
+            for (const auto index : this->group_index.match(pattern))
+                names.push_back(std::next(this->groups.begin(), index)->first);
+
             return names;
         }
 
@@ -2345,9 +2403,11 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         const size_t gseqIndex = this->groups.size();
 
         groups.insert( std::make_pair( groupName, DynamicState<std::shared_ptr<Group2>>(this->m_timeMap, nullptr)));
+        this->group_index.add(groupName);
         auto group_ptr = std::make_shared<Group2>(groupName, gseqIndex, timeStep, this->getUDQConfig(timeStep).params().undefinedValue(), unit_system);
         auto& dynamic_state = this->groups.at(groupName);
         dynamic_state.update(timeStep, group_ptr);
+        this->wellsModified();
 
         m_events.addEvent( ScheduleEvents::NEW_GROUP , timeStep );
 
@@ -2508,6 +2568,8 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
                     well_pair.second->filterConnections(grid);
             }
         }
+
+        this->wellsModified();
     }
 
     const VFPProdTable& Schedule::getVFPProdTable(int table_id, size_t timeStep) const {
@@ -2625,6 +2687,15 @@ void Schedule::handleGRUPTREE( const DeckKeyword& keyword, size_t currentStep, c
         return this->m_nupcol.get(reportStep);
     }
 
+    std::size_t Schedule::modificationCount() const {
+        return this->m_modification_count;
+    }
+
+    void Schedule::wellsModified() {
+        this->child_wells_cache.wells.clear();
+        this->m_modification_count += 1;
+    }
+
 
 
 }
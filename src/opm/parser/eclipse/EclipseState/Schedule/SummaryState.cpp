@@ -17,11 +17,16 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <unordered_map>
 #include <cstring>
+#include <stdexcept>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
+#include <string>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/SummaryState.hpp>
 
@@ -51,8 +56,27 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
+    std::uint64_t next_instance_id() {
+        static std::atomic<std::uint64_t> next_id{1};
+        return next_id++;
+    }
+
 }
 
+    SummaryState::InstanceId::InstanceId() :
+        value(next_instance_id())
+    {}
+
+    SummaryState::InstanceId::InstanceId(const InstanceId&) :
+        value(next_instance_id())
+    {}
+
+    SummaryState::InstanceId& SummaryState::InstanceId::operator=(const InstanceId&) {
+        this->value = next_instance_id();
+        return *this;
+    }
+
+
     SummaryState::SummaryState(std::chrono::system_clock::time_point sim_start_arg):
         sim_start(sim_start_arg)
     {
@@ -80,55 +104,161 @@ namespace {
     }
 
 
-    void SummaryState::update(const std::string& key, double value) {
-        if (is_total(key))
-            this->values[key] += value;
+    std::size_t SummaryState::intern(const std::string& key, SlotType type) {
+        auto iter = this->key_index.find(key);
+        if (iter != this->key_index.end()) {
+            auto slot = iter->second;
+            if (type != SlotType::Plain)
+                this->slot_types[slot] = type;
+
+            return slot;
+        }
+
+        auto slot = this->entries.size();
+        this->key_index.emplace(key, slot);
+        this->entries.emplace_back(key, 0);
+        this->entity_values.push_back(0);
+        this->has_values.push_back(false);
+        this->is_totals.push_back(is_total(key));
+        this->slot_types.push_back(type);
+        this->registered.push_back(false);
+
+        return slot;
+    }
+
+
+    std::size_t SummaryState::entity_var_handle(const std::unordered_map<std::string, std::unordered_map<std::string, std::size_t>>& entity_slots,
+                                                const std::string& entity, const std::string& var, SlotType type) {
+        const auto& var_iter = entity_slots.find(var);
+        if (var_iter != entity_slots.end()) {
+            const auto& entity_iter = var_iter->second.find(entity);
+            if (entity_iter != var_iter->second.end())
+                return entity_iter->second;
+        }
+
+        return this->intern(var + ":" + entity, type);
+    }
+
+
+    std::size_t SummaryState::handle(const std::string& key) {
+        return this->intern(key, SlotType::Plain);
+    }
+
+
+    std::size_t SummaryState::well_var_handle(const std::string& well, const std::string& var) {
+        return this->entity_var_handle(this->well_values, well, var, SlotType::Well);
+    }
+
+
+    std::size_t SummaryState::group_var_handle(const std::string& group, const std::string& var) {
+        return this->entity_var_handle(this->group_values, group, var, SlotType::Group);
+    }
+
+
+    void SummaryState::assign(std::size_t slot, double value) {
+        if (!this->has_values[slot]) {
+            this->has_values[slot] = true;
+            this->num_values += 1;
+        }
+
+        this->entries[slot].second = value;
+    }
+
+
+    void SummaryState::accumulate(std::size_t slot, double value) {
+        if (this->is_totals[slot] && this->has_values[slot])
+            this->entries[slot].second += value;
         else
-            this->values[key] = value;
+            this->assign(slot, value);
     }
 
 
-    void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
-        std::string key = var + ":" + group;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->group_values[var][group] += value;
+    /*
+      Makes a well or group slot available through the specialized well and
+      group accessors. The key of such a slot is 'var:entity'.
+    */
+    void SummaryState::register_slot(std::size_t slot) {
+        const auto& key = this->entries[slot].first;
+        const auto sep_pos = key.find(':');
+        const auto var = key.substr(0, sep_pos);
+        const auto entity = key.substr(sep_pos + 1);
+
+        if (this->slot_types[slot] == SlotType::Well) {
+            this->well_values[var][entity] = slot;
+            this->m_wells.insert(entity);
         } else {
-            this->values[key] = value;
-            this->group_values[var][group] = value;
+            this->group_values[var][entity] = slot;
+            this->m_groups.insert(entity);
+        }
+
+        this->registered[slot] = true;
+    }
+
+
+    void SummaryState::update_value(std::size_t slot, double value) {
+        this->accumulate(slot, value);
+
+        if (this->slot_types[slot] != SlotType::Plain) {
+            if (!this->registered[slot]) {
+                this->entity_values[slot] = value;
+                this->register_slot(slot);
+            } else if (this->is_totals[slot])
+                this->entity_values[slot] += value;
+            else
+                this->entity_values[slot] = value;
         }
-        this->m_groups.insert(group);
+    }
+
+
+    bool SummaryState::has_value(std::size_t slot) const {
+        return this->has_values[slot];
+    }
+
+
+    double SummaryState::get_value(std::size_t slot) const {
+        if (!this->has_values[slot])
+            throw std::out_of_range("No value for key: " + this->entries[slot].first);
+
+        return this->entries[slot].second;
+    }
+
+
+    std::uint64_t SummaryState::instance_id() const {
+        return this->m_instance_id.value;
+    }
+
+
+    void SummaryState::update(const std::string& key, double value) {
+        this->accumulate(this->intern(key, SlotType::Plain), value);
+    }
+
+
+    void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
+        this->update_value(this->group_var_handle(group, var), value);
     }
 
     void SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
-        std::string key = var + ":" + well;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->well_values[var][well] += value;
-        } else {
-            this->values[key] = value;
-            this->well_values[var][well] = value;
-        }
-        this->m_wells.insert(well);
+        this->update_value(this->well_var_handle(well, var), value);
     }
 
 
     void SummaryState::set(const std::string& key, double value) {
-        this->values[key] = value;
+        this->assign(this->intern(key, SlotType::Plain), value);
     }
 
 
     bool SummaryState::has(const std::string& key) const {
-        return (this->values.find(key) != this->values.end());
+        const auto iter = this->key_index.find(key);
+        return (iter != this->key_index.end()) && this->has_values[iter->second];
     }
 
 
     double SummaryState::get(const std::string& key) const {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto iter = this->key_index.find(key);
+        if ((iter == this->key_index.end()) || !this->has_values[iter->second])
             throw std::out_of_range("No such key: " + key);
 
-        return iter->second;
+        return this->entries[iter->second].second;
     }
 
     bool SummaryState::has_well_var(const std::string& well, const std::string& var) const {
@@ -144,7 +274,7 @@ namespace {
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var) const {
-        return this->well_values.at(var).at(well);
+        return this->entity_values[this->well_values.at(var).at(well)];
     }
 
     bool SummaryState::has_group_var(const std::string& group, const std::string& var) const {
@@ -160,16 +290,56 @@ namespace {
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var) const {
-        return this->group_values.at(var).at(group);
+        return this->entity_values[this->group_values.at(var).at(group)];
+    }
+
+    SummaryState::const_iterator::const_iterator(const SummaryState& st_arg, std::size_t slot_arg) :
+        st(&st_arg),
+        slot(slot_arg)
+    {
+        this->skip_empty();
+    }
+
+    void SummaryState::const_iterator::skip_empty() {
+        while ((this->slot < this->st->entries.size()) && !this->st->has_values[this->slot])
+            this->slot += 1;
+    }
+
+    SummaryState::const_iterator::reference SummaryState::const_iterator::operator*() const {
+        return this->st->entries[this->slot];
+    }
+
+    SummaryState::const_iterator::pointer SummaryState::const_iterator::operator->() const {
+        return &this->st->entries[this->slot];
+    }
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++() {
+        this->slot += 1;
+        this->skip_empty();
+        return *this;
+    }
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int) {
+        auto copy = *this;
+        ++(*this);
+        return copy;
+    }
+
+    bool SummaryState::const_iterator::operator==(const const_iterator& other) const {
+        return (this->st == other.st) && (this->slot == other.slot);
+    }
+
+    bool SummaryState::const_iterator::operator!=(const const_iterator& other) const {
+        return !(*this == other);
     }
 
     SummaryState::const_iterator SummaryState::begin() const {
-        return this->values.begin();
+        return const_iterator(*this, 0);
     }
 
 
     SummaryState::const_iterator SummaryState::end() const {
-        return this->values.end();
+        return const_iterator(*this, this->entries.size());
     }
 
 
@@ -211,35 +381,55 @@ namespace {
     }
 
     std::size_t SummaryState::size() const {
-        return this->values.size();
+        return this->num_values;
     }
 
 
-namespace {
-    class Serializer {
-    public:
-        Serializer() = default;
-        explicit Serializer(const std::vector<char>& buffer_arg) :
-            buffer(buffer_arg)
-        {}
+    std::size_t SummaryState::num_keys() const {
+        return this->entries.size();
+    }
 
 
-        template <typename T>
-        void put(const T& value) {
-            this->pack(std::addressof(value), sizeof(T));
+    void SummaryState::rebuild_registered(const std::vector<char>& new_registered) {
+        this->m_wells.clear();
+        this->well_values.clear();
+        this->m_groups.clear();
+        this->group_values.clear();
+        std::fill(this->registered.begin(), this->registered.end(), false);
+
+        for (std::size_t slot = 0; slot < new_registered.size(); slot++) {
+            if (new_registered[slot])
+                this->register_slot(slot);
         }
+    }
 
 
+namespace {
+    /*
+      Layout of a serialized buffer:
+
+        version
+        elapsed
+        known_keys                     : 0 for a full buffer
+        num_keys - known_keys new keys : key, slot type
+        num_keys slot flags            : has value, registered
+        values of the slots with has value set
+        well and group values of the slots with registered set
+    */
+    const std::uint32_t serialize_version = 2;
+
+    const char has_value_flag = 1;
+    const char registered_flag = 2;
 
+    class Serializer {
+    public:
         template <typename T>
-        T get() {
-            T value;
-            std::memcpy(&value, &this->buffer[pos], sizeof(T));
-            this->pos += sizeof(T);
-            return value;
+        void put(const T& value) {
+            this->pack(std::addressof(value), sizeof(T));
         }
 
         std::vector<char> buffer;
+
     private:
         void pack(const void * ptr, std::size_t value_size) {
             std::size_t write_pos = this->buffer.size();
@@ -247,8 +437,6 @@ namespace {
             this->buffer.resize( new_size );
             std::memcpy(&this->buffer[write_pos], ptr, value_size);
         }
-
-        std::size_t pos = 0;
     };
 
     template <>
@@ -257,91 +445,138 @@ namespace {
         this->pack(value.c_str(), value.size());
     }
 
-    template <>
-    std::string Serializer::get() {
-        std::string::size_type length = this->get<std::string::size_type>();
-        this->pos += length;
-        return {std::addressof(this->buffer[this->pos - length]), length};
-    }
 
-    void put_map(Serializer& ser, const std::unordered_map<std::string, double>& values) {
-        ser.put(values.size());
-        for (const auto& value_pair : values) {
-            ser.put(value_pair.first);
-            ser.put(value_pair.second);
+    class Deserializer {
+    public:
+        explicit Deserializer(const std::vector<char>& buffer_arg) :
+            buffer(buffer_arg)
+        {}
+
+        template <typename T>
+        T get() {
+            T value;
+            std::memcpy(&value, this->next(sizeof(T)), sizeof(T));
+            return value;
+        }
+
+    private:
+        const char * next(std::size_t size) {
+            if (size > this->buffer.size() - this->pos)
+                throw std::invalid_argument("Truncated SummaryState buffer");
+
+            const char * ptr = this->buffer.data() + this->pos;
+            this->pos += size;
+            return ptr;
         }
+
+        const std::vector<char>& buffer;
+        std::size_t pos = 0;
+    };
+
+    template <>
+    std::string Deserializer::get() {
+        std::string::size_type length = this->get<std::string::size_type>();
+        return {this->next(length), length};
     }
 
 }
 
     std::vector<char> SummaryState::serialize() const {
+        return this->serialize_delta(0);
+    }
+
+
+    std::vector<char> SummaryState::serialize_delta(std::size_t known_keys) const {
+        if (known_keys > this->entries.size())
+            throw std::invalid_argument("Can not serialize SummaryState with " + std::to_string(known_keys)
+                                        + " known keys, there are only " + std::to_string(this->entries.size()) + " keys");
+
         Serializer ser;
+        ser.buffer.reserve(sizeof(serialize_version) + 3*sizeof(std::size_t) + sizeof(double) * (1 + this->num_values) + this->entries.size());
+        ser.put(serialize_version);
         ser.put(this->elapsed);
-        put_map(ser, values);
 
-        ser.put(this->well_values.size());
-        for (const auto& well_var_pair : this->well_values) {
-            ser.put(well_var_pair.first);
-            put_map(ser, well_var_pair.second);
+        ser.put(known_keys);
+        ser.put(this->entries.size());
+        for (std::size_t slot = known_keys; slot < this->entries.size(); slot++) {
+            ser.put(this->entries[slot].first);
+            ser.put(this->slot_types[slot]);
+        }
+
+        for (std::size_t slot = 0; slot < this->entries.size(); slot++) {
+            char flags = 0;
+            if (this->has_values[slot])
+                flags |= has_value_flag;
+
+            if (this->registered[slot])
+                flags |= registered_flag;
+
+            ser.put(flags);
         }
 
-        ser.put(this->group_values.size());
-        for (const auto& group_var_pair : this->group_values) {
-            ser.put(group_var_pair.first);
-            put_map(ser, group_var_pair.second);
+        for (std::size_t slot = 0; slot < this->entries.size(); slot++) {
+            if (this->has_values[slot])
+                ser.put(this->entries[slot].second);
+        }
+
+        for (std::size_t slot = 0; slot < this->entries.size(); slot++) {
+            if (this->registered[slot])
+                ser.put(this->entity_values[slot]);
         }
 
         return std::move(ser.buffer);
     }
 
 
-    void  SummaryState::deserialize(const std::vector<char>& buffer) {
-        this->values.clear();
-        this->m_wells.clear();
-        this->well_values.clear();
-        this->m_groups.clear();
-        this->group_values.clear();
-        this->elapsed = 0;
-
-        Serializer ser(buffer);
-        this->elapsed = ser.get<double>();
-        {
-            std::size_t num_values = ser.get<std::size_t>();
-            for (std::size_t index = 0; index < num_values; index++) {
-                std::string key = ser.get<std::string>();
-                double value = ser.get<double>();
-                this->update(key, value);
-            }
+    void SummaryState::deserialize(const std::vector<char>& buffer) {
+        Deserializer ser(buffer);
+        const auto version = ser.get<std::uint32_t>();
+        if (version != serialize_version)
+            throw std::invalid_argument("Unsupported SummaryState serialization version: " + std::to_string(version));
+
+        const auto elapsed_arg = ser.get<double>();
+        const auto known_keys = ser.get<std::size_t>();
+        const auto remote_keys = ser.get<std::size_t>();
+        if (known_keys == 0)
+            this->remote_slots.clear();
+        else if (known_keys != this->remote_slots.size())
+            throw std::invalid_argument("SummaryState delta buffer expects " + std::to_string(known_keys)
+                                        + " known keys, but " + std::to_string(this->remote_slots.size()) + " keys are known");
+
+        for (std::size_t index = known_keys; index < remote_keys; index++) {
+            const auto key = ser.get<std::string>();
+            const auto type = ser.get<SlotType>();
+            this->remote_slots.push_back(this->intern(key, type));
         }
 
-        {
-            std::size_t num_well_var = ser.get<std::size_t>();
-            for (std::size_t var_index = 0; var_index < num_well_var; var_index++) {
-                std::string var = ser.get<std::string>();
-
-                std::size_t num_well = ser.get<std::size_t>();
-                for (std::size_t well_index=0; well_index < num_well; well_index++) {
-                    std::string well = ser.get<std::string>();
-                    double value = ser.get<double>();
-                    this->update_well_var(well, var, value);
-                }
-            }
+        std::vector<char> new_registered(this->entries.size(), false);
+        std::fill(this->has_values.begin(), this->has_values.end(), false);
+        for (const auto slot : this->remote_slots) {
+            const auto flags = ser.get<char>();
+            this->has_values[slot] = (flags & has_value_flag) != 0;
+            new_registered[slot] = (flags & registered_flag) != 0;
         }
 
-        {
-            std::size_t num_group_var = ser.get<std::size_t>();
-            for (std::size_t var_index = 0; var_index < num_group_var; var_index++) {
-                std::string var = ser.get<std::string>();
-
-                std::size_t num_group = ser.get<std::size_t>();
-                for (std::size_t group_index=0; group_index < num_group; group_index++) {
-                    std::string group = ser.get<std::string>();
-                    double value = ser.get<double>();
-                    this->update_group_var(group, var, value);
-                }
+        this->num_values = 0;
+        for (const auto slot : this->remote_slots) {
+            if (this->has_values[slot]) {
+                this->entries[slot].second = ser.get<double>();
+                this->num_values += 1;
             }
         }
-     }
+
+        for (const auto slot : this->remote_slots) {
+            if (new_registered[slot])
+                this->entity_values[slot] = ser.get<double>();
+        }
+
+        // The well and group lookup only needs to be rebuilt when the set of
+        // registered slots has changed, which is rare after the first buffer.
+        if (new_registered != this->registered)
+            this->rebuild_registered(new_registered);
+
+        this->elapsed = elapsed_arg;
+    }
 
     std::ostream& operator<<(std::ostream& stream, const SummaryState& st) {
         stream << "Simulated seconds: " << st.get_elapsed() << std::endl;
@@ -16,11 +16,11 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <fnmatch.h>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQFunctionTable.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 
 #include "UDQASTNode.hpp"
 
@@ -105,14 +105,14 @@ UDQSet UDQASTNode::eval(UDQVarType target_type, const UDQContext& context) const
             const auto& wells = context.wells();
 
             if (this->selector.size() > 0) {
-                int fnmatch_flags = 0;
                 const std::string& well_pattern = this->selector[0];
                 if (well_pattern.find("*") == std::string::npos)
                     return UDQSet::wells(this->string_value, wells, context.get_well_var(well_pattern, this->string_value));
                 else {
+                    NamePattern pattern(well_pattern);
                     auto res = UDQSet::wells(this->string_value, wells);
                     for (const auto& well : wells) {
-                        if (fnmatch(well_pattern.c_str(), well.c_str(), fnmatch_flags) == 0) {
+                        if (pattern.match(well)) {
                             if (context.has_well_var(well, this->string_value))
                                 res.assign(well, context.get_well_var(well, this->string_value));
                         }
@@ -133,14 +133,14 @@ UDQSet UDQASTNode::eval(UDQVarType target_type, const UDQContext& context) const
             const auto& groups = context.groups();
 
             if (this->selector.size() > 0) {
-                int fnmatch_flags = 0;
                 const std::string& group_pattern = this->selector[0];
                 if (group_pattern.find("*") == std::string::npos)
                     return UDQSet::groups(this->string_value, groups, context.get_group_var(group_pattern, this->string_value));
                 else {
+                    NamePattern pattern(group_pattern);
                     auto res = UDQSet::groups(this->string_value, groups);
                     for (const auto& group : groups) {
-                        if (fnmatch(group_pattern.c_str(), group.c_str(), fnmatch_flags) == 0) {
+                        if (pattern.match(group)) {
                             if (context.has_group_var(group, this->string_value))
                                 res.assign(group, context.get_group_var(group, this->string_value));
                         }
@@ -302,14 +302,19 @@ namespace {
         std::iota(index.begin(), index.end(), 1);
         std::sort(index.begin(), index.end(), cmp);
 
-        std::size_t output_index = 0;
-        for (auto sort_index : index) {
-            while (!result[output_index])
-                output_index++;
-
-            result.assign(output_index, sort_index);
-            output_index++;
+        /*
+          The element holding the n'th defined value is assigned the rank of
+          that value, independent of the order of the elements.
+        */
+        std::vector<std::size_t> defined_index;
+        for (std::size_t output_index = 0; output_index < result.size(); output_index++) {
+            if (result[output_index])
+                defined_index.push_back(output_index);
         }
+
+        for (std::size_t rank = 0; rank < index.size(); rank++)
+            result.assign(defined_index[index[rank] - 1], rank + 1);
+
         return result;
     }
 }
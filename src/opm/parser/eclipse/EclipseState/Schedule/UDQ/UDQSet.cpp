@@ -16,9 +16,9 @@
   You should have received a copy of the GNU General Public License
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
-#include <fnmatch.h>
 
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQSet.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 
 namespace Opm {
 
@@ -184,9 +184,9 @@ void UDQSet::assign(const std::string& wgname, double value) {
         std::size_t index = this->wgname_index.at(wgname);
         UDQSet::assign(index, value);
     } else {
-        int flags = 0;
+        NamePattern pattern(wgname);
         for (const auto& pair : this->wgname_index) {
-            if (fnmatch(wgname.c_str(), pair.first.c_str(), flags) == 0)
+            if (pattern.match(pair.first))
                 UDQSet::assign(pair.second, value);
         }
     }
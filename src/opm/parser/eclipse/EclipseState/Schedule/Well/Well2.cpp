@@ -25,8 +25,8 @@
 #include <opm/parser/eclipse/EclipseState/Schedule/UDQ/UDQActive.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellInjectionProperties.hpp>
 #include <opm/parser/eclipse/EclipseState/Schedule/Well/WellProductionProperties.hpp>
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
 
-#include <fnmatch.h>
 
 namespace Opm {
 
@@ -727,11 +727,7 @@ double Well2::injection_rate(const SummaryState& st, Phase phase_arg) const {
 
 
 bool Well2::wellNameInWellNamePattern(const std::string& wellName, const std::string& wellNamePattern) {
-    bool wellNameInPattern = false;
-    if (fnmatch( wellNamePattern.c_str() , wellName.c_str() , 0 ) == 0) {
-        wellNameInPattern = true;
-    }
-    return wellNameInPattern;
+    return NamePattern(wellNamePattern).match(wellName);
 }
 
 
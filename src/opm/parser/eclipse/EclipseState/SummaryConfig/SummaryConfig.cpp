@@ -585,9 +585,9 @@ inline void keywordMISC( SummaryConfig::keyword_list& list,
 
         const auto segID = -1;
 
-        for (const auto& well : schedule.getWells2atEnd())
+        for (const auto* well : schedule.getWells2atEndPtr())
             makeSegmentNodes(last_timestep, segID, keyword,
-                             well, list);
+                             *well, list);
     }
 
     void keywordSWithRecords(const std::size_t            last_timestep,
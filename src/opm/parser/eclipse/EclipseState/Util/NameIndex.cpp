@@ -0,0 +1,149 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <fnmatch.h>
+
+#include <algorithm>
+
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
+
+namespace Opm {
+
+NamePattern::NamePattern(const std::string& pattern) :
+    m_pattern(pattern)
+{
+    const auto special_pos = pattern.find_first_of("*?[\\");
+    this->m_wildcard = (special_pos != std::string::npos);
+    this->m_prefix = pattern.substr(0, special_pos);
+    this->use_fnmatch = (pattern.find_first_of("[\\") != std::string::npos);
+    this->prefix_only = this->m_wildcard && (special_pos == pattern.size() - 1) && (pattern.back() == '*');
+}
+
+
+bool NamePattern::wildcard() const {
+    return this->m_wildcard;
+}
+
+
+const std::string& NamePattern::prefix() const {
+    return this->m_prefix;
+}
+
+
+const std::string& NamePattern::pattern() const {
+    return this->m_pattern;
+}
+
+
+bool NamePattern::match(const std::string& name) const {
+    if (!this->m_wildcard)
+        return name == this->m_pattern;
+
+    if (name.compare(0, this->m_prefix.size(), this->m_prefix) != 0)
+        return false;
+
+    if (this->prefix_only)
+        return true;
+
+    if (this->use_fnmatch)
+        return (fnmatch(this->m_pattern.c_str(), name.c_str(), 0) == 0);
+
+    return this->glob_match(name);
+}
+
+
+/*
+  Matching of the wildcards '*' and '?', backtracking to the last '*' on
+  mismatch.
+*/
+bool NamePattern::glob_match(const std::string& name) const {
+    const auto& pattern = this->m_pattern;
+    std::size_t pattern_pos = this->m_prefix.size();
+    std::size_t name_pos = this->m_prefix.size();
+    std::size_t star_pos = std::string::npos;
+    std::size_t star_name_pos = 0;
+
+    while (name_pos < name.size()) {
+        if (pattern_pos < pattern.size() && (pattern[pattern_pos] == '?' || (pattern[pattern_pos] != '*' && pattern[pattern_pos] == name[name_pos]))) {
+            pattern_pos++;
+            name_pos++;
+        } else if (pattern_pos < pattern.size() && pattern[pattern_pos] == '*') {
+            star_pos = pattern_pos;
+            star_name_pos = name_pos;
+            pattern_pos++;
+        } else if (star_pos != std::string::npos) {
+            pattern_pos = star_pos + 1;
+            star_name_pos++;
+            name_pos = star_name_pos;
+        } else
+            return false;
+    }
+
+    while (pattern_pos < pattern.size() && pattern[pattern_pos] == '*')
+        pattern_pos++;
+
+    return pattern_pos == pattern.size();
+}
+
+
+std::size_t NameIndex::add(const std::string& name) {
+    const auto index = this->sorted_names.size();
+    return this->sorted_names.emplace(name, index).first->second;
+}
+
+
+bool NameIndex::has(const std::string& name) const {
+    return this->sorted_names.count(name) > 0;
+}
+
+
+std::size_t NameIndex::size() const {
+    return this->sorted_names.size();
+}
+
+
+std::vector<std::size_t> NameIndex::match(const std::string& pattern) const {
+    return this->match(NamePattern(pattern));
+}
+
+
+std::vector<std::size_t> NameIndex::match(const NamePattern& pattern) const {
+    std::vector<std::size_t> indices;
+    if (!pattern.wildcard()) {
+        const auto iter = this->sorted_names.find(pattern.pattern());
+        if (iter != this->sorted_names.end())
+            indices.push_back(iter->second);
+
+        return indices;
+    }
+
+    const auto& prefix = pattern.prefix();
+    for (auto iter = this->sorted_names.lower_bound(prefix); iter != this->sorted_names.end(); ++iter) {
+        if (iter->first.compare(0, prefix.size(), prefix) != 0)
+            break;
+
+        if (pattern.match(iter->first))
+            indices.push_back(iter->second);
+    }
+
+    std::sort(indices.begin(), indices.end());
+    return indices;
+}
+
+}
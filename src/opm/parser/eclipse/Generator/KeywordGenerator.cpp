@@ -17,6 +17,7 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -109,23 +110,55 @@ namespace Opm {
 
         newSource << "void addDefaultKeywords(Parser& p);"  << std::endl
                   << "void addDefaultKeywords(Parser& p) {" << std::endl;
+        /*
+          Keywords which are only identified by their deck names are
+          registered lazily, and instantiated when the deck uses them. The
+          keywords with a deck name regex and the code keywords are needed to
+          scan the input, and are added directly.
+        */
         for( auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter ) {
-            newSource << "p.addKeyword< ParserKeywords::"
-                      << iter->second->className()
-                      << " >();" << std::endl;
+            const auto& keyword = *iter->second;
+            if (keyword.hasMatchRegex() || keyword.isCodeKeyword()) {
+                newSource << "p.addKeyword< ParserKeywords::"
+                          << keyword.className()
+                          << " >();" << std::endl;
+            } else {
+                newSource << "p.addLazyKeyword< ParserKeywords::"
+                          << keyword.className()
+                          << " >({";
+                for (auto name = keyword.deckNamesBegin(); name != keyword.deckNamesEnd(); ++name) {
+                    if (name != keyword.deckNamesBegin())
+                        newSource << ",";
+                    newSource << "\"" << *name << "\"";
+                }
+                newSource << "});" << std::endl;
+            }
         }
 
         newSource << "}" << std::endl;
 
+        /*
+          The definitions of the default keywords are identified by a hash
+          of their code, such that the Parser does not need to create the
+          lazy keywords to compare definitions.
+        */
+        std::uint64_t hash = 0xcbf29ce484222325ULL;
         for (auto iter = loader.keyword_begin(); iter != loader.keyword_end(); ++iter) {
             std::shared_ptr<ParserKeyword> keyword = (*iter).second;
-            newSource << keyword->createCode() << std::endl;
+            const auto code = keyword->createCode();
+            newSource << code << std::endl;
+
+            for (unsigned char c : code) {
+                hash ^= c;
+                hash *= 0x100000001b3ULL;
+            }
         }
 
         newSource << "}" << std::endl;
 
         newSource << "void Parser::addDefaultKeywords() {" << std::endl
                   << "  Opm::ParserKeywords::addDefaultKeywords(*this);" << std::endl
+                  << "  this->default_keywords_hash = \"" << std::hex << hash << std::dec << "\";" << std::endl
                   << "}}" << std::endl;
 
         return write_file( newSource, sourceFile, m_verbose, "source" );
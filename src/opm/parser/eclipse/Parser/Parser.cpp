@@ -17,8 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <deque>
 #include <fstream>
+#include <iterator>
+#include <mutex>
+#include <stack>
 
 #include <boost/algorithm/string.hpp>
 #include <boost/filesystem.hpp>
@@ -29,6 +35,7 @@
 #include <opm/json/JsonObject.hpp>
 
 #include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
 #include <opm/parser/eclipse/Deck/DeckItem.hpp>
 #include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/parser/eclipse/Deck/DeckRecord.hpp>
@@ -295,6 +302,108 @@ inline bool isTerminatedRecordString(const string_view& line) {
     return (line.back() == RawConsts::slash);
 }
 
+/*
+  Find the end of the group or alternative starting at pos, i.e. the position
+  of the first unbalanced ')' or - if stop_at_bar is set - top level '|'.
+*/
+std::size_t regex_scan(const std::string& regex, std::size_t pos, std::size_t end, bool stop_at_bar) {
+    int depth = 0;
+    while (pos < end) {
+        const char c = regex[pos];
+        if (c == '\\')
+            pos += 1;
+        else if (c == '[') {
+            pos += 1;
+            if (pos < end && regex[pos] == ']')
+                pos += 1;
+            while (pos < end && regex[pos] != ']')
+                pos += 1;
+        }
+        else if (c == '(')
+            depth += 1;
+        else if (c == ')') {
+            if (depth == 0)
+                return pos;
+            depth -= 1;
+        }
+        else if (c == '|' && depth == 0 && stop_at_bar)
+            return pos;
+
+        pos += 1;
+    }
+    return std::min(pos, end);
+}
+
+/*
+  Collect the characters a match of regex[begin, end) must start with. Only
+  the plain syntax used for the deck_name_regex of the keywords is
+  understood: alternatives starting with a literal, a character set or a
+  group. Returns false if the set of leading characters can not be
+  determined, in which case the caller must assume that anything can match.
+*/
+bool regex_leading_chars(const std::string& regex, std::size_t begin, std::size_t end, std::string& leading) {
+    std::size_t pos = begin;
+    while (true) {
+        if (pos >= end)
+            return false;
+
+        const char c = regex[pos];
+        std::size_t atom_end;
+        if (std::isalnum(static_cast<unsigned char>(c))) {
+            leading += c;
+            atom_end = pos + 1;
+        } else if (c == '(') {
+            const auto group_end = regex_scan(regex, pos + 1, end, false);
+            if (group_end >= end)
+                return false;
+
+            if (!regex_leading_chars(regex, pos + 1, group_end, leading))
+                return false;
+
+            atom_end = group_end + 1;
+        } else if (c == '[') {
+            atom_end = pos + 1;
+            if (atom_end < end && regex[atom_end] == '^')
+                return false;
+
+            while (atom_end < end && regex[atom_end] != ']') {
+                const char first = regex[atom_end];
+                if (!std::isalnum(static_cast<unsigned char>(first)))
+                    return false;
+
+                if (atom_end + 2 < end && regex[atom_end + 1] == '-' && regex[atom_end + 2] != ']') {
+                    const char last = regex[atom_end + 2];
+                    if (!std::isalnum(static_cast<unsigned char>(last)) || last < first)
+                        return false;
+
+                    for (char range_char = first; range_char <= last; range_char++)
+                        leading += range_char;
+
+                    atom_end += 3;
+                } else {
+                    leading += first;
+                    atom_end += 1;
+                }
+            }
+            if (atom_end >= end)
+                return false;
+
+            atom_end += 1;
+        } else
+            return false;
+
+        // An optional first atom means that the match can start with what follows.
+        if (atom_end < end && (regex[atom_end] == '?' || regex[atom_end] == '*' || regex[atom_end] == '{'))
+            return false;
+
+        pos = regex_scan(regex, atom_end, end, true);
+        if (pos >= end)
+            return true;
+
+        pos += 1;
+    }
+}
+
 }
 
 struct file {
@@ -354,6 +463,7 @@ class ParserState {
         std::string lastKeyWord;
 
         Deck deck;
+        std::vector< std::string > input_files;
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
@@ -432,7 +542,9 @@ void ParserState::loadFile(const boost::filesystem::path& inputFile) {
     boost::filesystem::path inputFileCanonical;
     try {
         inputFileCanonical = boost::filesystem::canonical(inputFile);
+        this->input_files.push_back( inputFileCanonical.string() );
     } catch (const boost::filesystem::filesystem_error& fs_error) {
+        this->input_files.push_back( boost::filesystem::absolute(inputFile).string() );
         std::string msg = "Could not open file: " + inputFile.string();
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, errors);
         return;
@@ -648,6 +760,18 @@ RawKeyword * newRawKeyword( const std::string& deck_name, ParserState& parserSta
 
 
 
+bool deferrable_data_keyword(const ParserKeyword& parserKeyword) {
+    if (!parserKeyword.isDataKeyword())
+        return false;
+
+    const auto& item = parserKeyword.getRecord(0).get(0);
+    if (item.parseRaw())
+        return false;
+
+    return item.dataType() == type_tag::integer || item.dataType() == type_tag::fdouble;
+}
+
+
 std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Parser& parser) {
     bool is_title = false;
     std::unique_ptr<RawKeyword> rawKeyword;
@@ -682,6 +806,9 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
                 if (ptr) {
                     rawKeyword.reset( ptr );
                     const auto& parserKeyword = parser.getParserKeywordFromDeckName(rawKeyword->getKeywordName());
+                    if (parser.deferredDataKeywords() && deferrable_data_keyword(parserKeyword))
+                        rawKeyword->deferData();
+
                     parserState.lastSizeType = parserKeyword.getSizeType();
                     parserState.lastKeyWord = deck_name;
                     if (rawKeyword->isFinished())
@@ -756,7 +883,7 @@ std::unique_ptr<RawKeyword> tryParseKeyword( ParserState& parserState, const Par
 
 
             if (str::isTerminatedRecordString(record_buffer)) {
-                RawRecord record( string_view{ record_buffer.begin(), record_buffer.end( ) - 1});
+                RawRecord record( string_view{ record_buffer.begin(), record_buffer.end( ) - 1}, rawKeyword->deferredData());
                 if (rawKeyword->addRecord(record))
                     return rawKeyword;
 
@@ -876,11 +1003,43 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
                  str::find_terminator( str.begin(), str.end(), str::find_comment() ) };
     }
 
-    Parser::Parser(bool addDefault) {
-        if (addDefault)
+    struct Parser::LazyKeywords {
+        struct Entry {
+            explicit Entry(ParserKeyword (*factory_arg)()) :
+                factory(factory_arg)
+            {}
+
+            ParserKeyword (*factory)();
+            std::atomic<const ParserKeyword*> keyword{ nullptr };
+        };
+
+        /*
+          The deck names are kept in a deque so that the string_view keys of
+          index remain valid as more names are added.
+        */
+        std::deque<std::string> deck_names;
+        std::unordered_map<string_view, std::size_t> index;
+        std::deque<Entry> entries;
+
+        std::list<ParserKeyword> storage;
+        std::mutex mutex;
+    };
+
+    Parser::Parser(bool addDefault) :
+        lazy_keywords(new LazyKeywords)
+    {
+        if (addDefault) {
             addDefaultKeywords();
+
+            this->default_keyword_count = this->keyword_storage.size();
+            this->default_lazy_count = this->lazy_keywords->entries.size();
+        }
     }
 
+    Parser::Parser(Parser&&) = default;
+    Parser& Parser::operator=(Parser&&) = default;
+    Parser::~Parser() = default;
+
 
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
@@ -935,8 +1094,27 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     }
 
     Deck Parser::parseFile(const std::string &dataFileName, const ParseContext& parseContext, ErrorGuard& errors) const {
+        if (this->deck_cache_directory.empty()) {
+            ParserState parserState( this->codeKeywords(), parseContext, errors, dataFileName );
+            parseState( parserState, *this );
+
+            return std::move( parserState.deck );
+        }
+
+        const DeckCache cache( this->deck_cache_directory, dataFileName );
+        {
+            Deck deck;
+            if (cache.load( *this, parseContext, deck )) {
+                deck.setDataFile( dataFileName );
+                OpmLog::info("Loaded deck from cache file " + cache.fileName());
+                return deck;
+            }
+        }
+
         ParserState parserState( this->codeKeywords(), parseContext, errors, dataFileName );
         parseState( parserState, *this );
+        if (!errors)
+            cache.store( *this, parseContext, parserState.deck, parserState.input_files );
 
         return std::move( parserState.deck );
     }
@@ -973,17 +1151,48 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
     }
 
     size_t Parser::size() const {
-        return m_deckParserKeywords.size();
+        return m_deckParserKeywords.size() + this->lazy_keywords->index.size();
     }
 
     const ParserKeyword* Parser::matchingKeyword(const string_view& name) const {
-        for (auto iter = m_wildCardKeywords.begin(); iter != m_wildCardKeywords.end(); ++iter) {
-            if (iter->second->matches(name))
-                return iter->second;
+        if (name.empty())
+            return nullptr;
+
+        const auto first = static_cast<unsigned char>(name.front());
+        if (first >= m_wildCardCandidates.size())
+            return nullptr;
+
+        for (const auto* keyword : m_wildCardCandidates[first]) {
+            if (keyword->matches(name))
+                return keyword;
         }
         return nullptr;
     }
 
+    void Parser::updateWildCardCandidates() {
+        for (auto& candidates : m_wildCardCandidates)
+            candidates.clear();
+
+        for (const auto& pair : m_wildCardKeywords) {
+            const auto* keyword = pair.second;
+            const auto& regex = keyword->getMatchRegex();
+            std::string leading;
+
+            if (str::regex_leading_chars(regex, 0, regex.size(), leading)) {
+                std::sort(leading.begin(), leading.end());
+                leading.erase(std::unique(leading.begin(), leading.end()), leading.end());
+                for (const auto c : leading) {
+                    const auto index = static_cast<unsigned char>(c);
+                    if (index < m_wildCardCandidates.size())
+                        m_wildCardCandidates[index].push_back(keyword);
+                }
+            } else {
+                for (auto& candidates : m_wildCardCandidates)
+                    candidates.push_back(keyword);
+            }
+        }
+    }
+
     bool Parser::hasWildCardKeyword(const std::string& internalKeywordName) const {
         return (m_wildCardKeywords.count(internalKeywordName) > 0);
     }
@@ -995,9 +1204,34 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if( m_deckParserKeywords.count( name ) )
             return true;
 
+        if( this->lazy_keywords->index.count( name ) )
+            return true;
+
         return bool( matchingKeyword( name ) );
     }
 
+    const ParserKeyword* Parser::lazyKeyword(const string_view& name) const {
+        auto& lazy = *this->lazy_keywords;
+        const auto iter = lazy.index.find( name );
+        if( iter == lazy.index.end() )
+            return nullptr;
+
+        auto& entry = lazy.entries[ iter->second ];
+        const auto* keyword = entry.keyword.load( std::memory_order_acquire );
+        if( keyword )
+            return keyword;
+
+        std::lock_guard<std::mutex> lock( lazy.mutex );
+        keyword = entry.keyword.load( std::memory_order_relaxed );
+        if( !keyword ) {
+            lazy.storage.push_back( entry.factory() );
+            keyword = std::addressof( lazy.storage.back() );
+            entry.keyword.store( keyword, std::memory_order_release );
+        }
+
+        return keyword;
+    }
+
 void Parser::addParserKeyword( ParserKeyword&& parserKeyword ) {
     /* Store the keywords in the keyword storage. They aren't free'd until the
      * parser gets destroyed, even if there is no reasonable way to reach them
@@ -1025,10 +1259,13 @@ void Parser::addParserKeyword( ParserKeyword&& parserKeyword ) {
             ++nameIt)
     {
         m_deckParserKeywords[ *nameIt ] = ptr;
+        this->lazy_keywords->index.erase( *nameIt );
     }
 
-    if (ptr->hasMatchRegex())
+    if (ptr->hasMatchRegex()) {
         m_wildCardKeywords[ name ] = ptr;
+        this->updateWildCardCandidates();
+    }
 
     if (ptr->isCodeKeyword())
         this->code_keywords.emplace_back( ptr->getName(), ptr->codeEnd() );
@@ -1039,9 +1276,23 @@ void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
 }
 
+void Parser::addLazyKeyword(const std::vector<std::string>& deckNames, ParserKeyword (*factory)()) {
+    auto& lazy = *this->lazy_keywords;
+    const auto entry_index = lazy.entries.size();
+    lazy.entries.emplace_back( factory );
+
+    for (const auto& deck_name : deckNames) {
+        m_deckParserKeywords.erase( string_view( deck_name ) );
+
+        lazy.deck_names.push_back( deck_name );
+        lazy.index[ string_view( lazy.deck_names.back() ) ] = entry_index;
+    }
+}
+
 bool Parser::hasKeyword( const std::string& name ) const {
     return this->m_deckParserKeywords.find( string_view( name ) )
-        != this->m_deckParserKeywords.end();
+        != this->m_deckParserKeywords.end()
+        || this->lazy_keywords->index.count( string_view( name ) ) > 0;
 }
 
 const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
@@ -1053,6 +1304,9 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const string_view& nam
 
     if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
 
+    const auto* lazy = lazyKeyword( name );
+    if( lazy ) return *lazy;
+
     const auto* wildCardKeyword = matchingKeyword( name );
 
     if ( !wildCardKeyword )
@@ -1061,11 +1315,32 @@ const ParserKeyword& Parser::getParserKeywordFromDeckName(const string_view& nam
     return *wildCardKeyword;
 }
 
+std::string Parser::keywordDefinitions() const {
+    std::string definitions = this->default_keywords_hash;
+    definitions += '\n';
+
+    auto keyword = this->keyword_storage.begin();
+    std::advance( keyword, this->default_keyword_count );
+    for (; keyword != this->keyword_storage.end(); ++keyword)
+        definitions += keyword->createCode();
+
+    const auto& lazy = *this->lazy_keywords;
+    for (auto entry = lazy.entries.begin() + this->default_lazy_count; entry != lazy.entries.end(); ++entry) {
+        const auto* lazy_keyword = entry->keyword.load( std::memory_order_acquire );
+        definitions += lazy_keyword ? lazy_keyword->createCode() : entry->factory().createCode();
+    }
+
+    return definitions;
+}
+
 std::vector<std::string> Parser::getAllDeckNames () const {
     std::vector<std::string> keywords;
     for (auto iterator = m_deckParserKeywords.begin(); iterator != m_deckParserKeywords.end(); iterator++) {
         keywords.push_back(iterator->first.string());
     }
+    for (const auto& pair : this->lazy_keywords->index) {
+        keywords.push_back(pair.first.string());
+    }
     for (auto iterator = m_wildCardKeywords.begin(); iterator != m_wildCardKeywords.end(); iterator++) {
         keywords.push_back(iterator->first.string());
     }
@@ -1119,6 +1394,22 @@ std::vector<std::string> Parser::getAllDeckNames () const {
         return this->code_keywords;
     }
 
+    void Parser::deferDataKeywords(bool defer) {
+        this->defer_data_keywords = defer;
+    }
+
+    bool Parser::deferredDataKeywords() const {
+        return this->defer_data_keywords;
+    }
+
+    void Parser::setDeckCacheDirectory(const std::string& directory) {
+        this->deck_cache_directory = directory;
+    }
+
+    const std::string& Parser::deckCacheDirectory() const {
+        return this->deck_cache_directory;
+    }
+
 
 #if 0
     void Parser::applyUnitsToDeck(Deck& deck) const {
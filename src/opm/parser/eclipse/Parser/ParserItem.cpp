@@ -17,6 +17,9 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <exception>
+#include <memory>
 #include <ostream>
 #include <sstream>
 #include <iomanip>
@@ -31,6 +34,7 @@
 #include <opm/parser/eclipse/Deck/UDAValue.hpp>
 #include <opm/parser/eclipse/Units/UnitSystem.hpp>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 #include "raw/StarToken.hpp"
 
@@ -613,6 +617,103 @@ DeckItem ParserItem::scan( RawRecord& record, UnitSystem& active_unitsystem, Uni
     }
 }
 
+namespace {
+
+/*
+  Tokenize the text of a deferred data item into item. The text is split in
+  chunks at whitespace, which are scanned in parallel into copies of the empty
+  item and then appended in order; a repeat count like 10*0.25 is a single
+  token, and is therefore never split between chunks.
+*/
+template< typename T >
+void load_deferred( DeckItem& item, const ParserItem& parser_item, const std::string& data ) {
+    const std::size_t chunk_size = 1 << 20;
+    if( data.size() < 2 * chunk_size ) {
+        RawRecord record( data );
+        scan_item< T >( item, parser_item, record );
+        return;
+    }
+
+    const RawConsts::is_separator separator;
+    std::vector< string_view > chunks;
+    auto begin = data.data();
+    const auto end = data.data() + data.size();
+    while( begin != end ) {
+        auto split = std::min( begin + chunk_size, end );
+        split = std::find_if( split, end, separator );
+        chunks.emplace_back( begin, split );
+        begin = split;
+    }
+
+    std::vector< DeckItem > chunk_items( chunks.size(), item );
+    std::exception_ptr error;
+
+#pragma omp parallel for schedule(dynamic)
+    for( int c = 0; c < static_cast< int >( chunks.size() ); c++ ) {
+        try {
+            RawRecord record( chunks[ c ] );
+            scan_item< T >( chunk_items[ c ], parser_item, record );
+        } catch( ... ) {
+#pragma omp critical
+            if( !error ) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if( error ) {
+        std::rethrow_exception( error );
+    }
+
+    for( const auto& chunk_item : chunk_items ) {
+        const auto& values = chunk_item.getData< T >();
+        for( std::size_t index = 0; index < values.size(); index++ ) {
+            if( chunk_item.defaultApplied( index ) )
+                item.push_backDefault( values[ index ] );
+            else
+                item.push_back( values[ index ] );
+        }
+    }
+}
+
+}
+
+DeckItem ParserItem::scanDeferred( const string_view& data, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const {
+    if( this->sizeType() != ParserItem::item_size::ALL || this->parseRaw() )
+        throw std::logic_error( "ParserItem::scanDeferred: Item " + this->name() + " can not be deferred" );
+
+    auto text = std::make_shared< const std::string >( data.string() );
+    auto parser_item = std::make_shared< const ParserItem >( *this );
+
+    switch( this->data_type ) {
+    case type_tag::integer:
+        {
+            DeckItem item( this->name(), int() );
+            item.setLoader( [text, parser_item]( DeckItem& target ) {
+                load_deferred< int >( target, *parser_item, *text );
+            }, text );
+            return item;
+        }
+    case type_tag::fdouble:
+        {
+            std::vector<Dimension> active_dimensions;
+            std::vector<Dimension> default_dimensions;
+            for (const auto& dim_string : this->m_dimensions) {
+                active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
+                default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
+            }
+
+            DeckItem item( this->name(), double(), active_dimensions, default_dimensions );
+            item.setLoader( [text, parser_item]( DeckItem& target ) {
+                load_deferred< double >( target, *parser_item, *text );
+            }, text );
+            return item;
+        }
+    default:
+        throw std::logic_error( "ParserItem::scanDeferred: Item " + this->name() + " can not be deferred" );
+    }
+}
+
 std::ostream& ParserItem::inlineClass( std::ostream& stream, const std::string& indent ) const {
     std::string local_indent = indent + "    ";
 
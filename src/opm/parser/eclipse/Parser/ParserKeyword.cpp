@@ -516,7 +516,13 @@ void set_dimensions( ParserItem& item,
             if( m_records.size() == 0 && rawRecord.size() > 0 )
                 throw std::invalid_argument("Missing item information " + rawKeyword.getKeywordName());
 
-            keyword.addRecord( this->getRecord( record_nr ).parse( parseContext, errors, rawRecord, active_unitsystem, default_unitsystem, rawKeyword.getKeywordName(), filename ) );
+            if (rawKeyword.deferredData()) {
+                const auto& parserItem = this->getRecord( record_nr ).get( 0 );
+                std::vector< DeckItem > items;
+                items.push_back( parserItem.scanDeferred( rawRecord.getItem( 0 ), active_unitsystem, default_unitsystem ) );
+                keyword.addRecord( DeckRecord( std::move( items ) ) );
+            } else
+                keyword.addRecord( this->getRecord( record_nr ).parse( parseContext, errors, rawRecord, active_unitsystem, default_unitsystem, rawKeyword.getKeywordName(), filename ) );
             record_nr++;
         }
 
@@ -584,11 +590,16 @@ void set_dimensions( ParserItem& item,
         }
     }
 
+    const std::string& ParserKeyword::getMatchRegex() const {
+        return m_matchRegexString;
+    }
+
     bool ParserKeyword::matches(const string_view& name ) const {
         if (!validDeckName(name ))
             return false;
 
-        else if( m_deckNames.count( name.string() ) )
+        else if( std::any_of( m_deckNames.begin(), m_deckNames.end(),
+                              [&name]( const std::string& deck_name ) { return name == deck_name; } ) )
             return true;
 
         else if (hasMatchRegex())
@@ -159,5 +159,13 @@ namespace {
         return this->raw_string_keyword;
     }
 
+    void RawKeyword::deferData() {
+        this->m_deferredData = true;
+    }
+
+    bool RawKeyword::deferredData() const {
+        return this->m_deferredData;
+    }
+
 }
 
@@ -55,6 +55,11 @@ namespace Opm {
         bool rawStringKeyword() const;
         const Location& location() const;
 
+        // The records of a keyword with deferred data are not split in
+        // tokens, the text is kept for ParserItem::scanDeferred().
+        void deferData();
+        bool deferredData() const;
+
         using const_iterator = std::vector< RawRecord >::const_iterator;
         using iterator = std::vector< RawRecord >::iterator;
 
@@ -72,6 +77,7 @@ namespace Opm {
         size_t m_numTables = 0;
         size_t m_currentNumTables = 0;
         bool m_isFinished = false;
+        bool m_deferredData = false;
 
         std::vector< RawRecord > m_records;
     };
@@ -20,19 +20,19 @@
 #include <array>
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
+#include <limits>
+#include <locale>
+#include <sstream>
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
 
-#include <boost/spirit/include/qi.hpp>
-
 #include <opm/parser/eclipse/Utility/Stringview.hpp>
 #include <opm/parser/eclipse/Deck/UDAValue.hpp>
 
 #include "StarToken.hpp"
 
-namespace qi = boost::spirit::qi;
-
 namespace Opm {
 
     bool isStarToken(const string_view& token,
@@ -71,39 +71,211 @@ namespace Opm {
         return true;
     }
 
-    template<>
-    int readValueToken< int >( string_view view ) {
-        int n = 0;
-        auto cursor = view.begin();
-        const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
+namespace {
 
-        if( ok && cursor == view.end() ) return n;
-        throw std::invalid_argument( "Malformed integer '" + view + "'" );
+    inline bool is_digit( char c ) {
+        return c >= '0' && c <= '9';
     }
 
-    template< typename T >
-    struct fortran_double : qi::real_policies< T > {
+    inline bool is_exponent( char c ) {
         // Eclipse supports Fortran syntax for specifying exponents of floating point
         // numbers ('D' and 'E', e.g., 1.234d5)
-        template< typename It >
-        static bool parse_exp( It& first, const It& last ) {
-            if( first == last ||
-                (*first != 'e' && *first != 'E' &&
-                *first != 'd' && *first != 'D' ) )
+        return c == 'e' || c == 'E' || c == 'd' || c == 'D';
+    }
+
+    inline bool match_nocase( string_view::const_iterator& first,
+                              string_view::const_iterator last,
+                              const char* word ) {
+        auto cursor = first;
+        for( ; *word != '\0'; ++word, ++cursor ) {
+            if( cursor == last || std::tolower( static_cast< unsigned char >( *cursor ) ) != *word )
+                return false;
+        }
+        first = cursor;
+        return true;
+    }
+
+    bool read_int( const string_view& view, int& value ) {
+        auto cursor = view.begin();
+        const auto end = view.end();
+
+        bool negative = false;
+        if( cursor != end && ( *cursor == '+' || *cursor == '-' ) ) {
+            negative = *cursor == '-';
+            ++cursor;
+        }
+
+        if( cursor == end )
+            return false;
+
+        const std::int64_t limit = negative
+                                 ? -static_cast< std::int64_t >( std::numeric_limits< int >::min() )
+                                 : std::numeric_limits< int >::max();
+        std::int64_t n = 0;
+        for( ; cursor != end; ++cursor ) {
+            if( !is_digit( *cursor ) )
+                return false;
+
+            n = 10 * n + ( *cursor - '0' );
+            if( n > limit )
+                return false;
+        }
+
+        value = static_cast< int >( negative ? -n : n );
+        return true;
+    }
+
+    /*
+      Fallback for the numbers which can not be converted exactly in
+      read_double(), i.e. with more than 19 significant digits or a large
+      exponent. Formatted input with the classic locale rounds correctly and
+      does not depend on the global locale, as strtod() does.
+    */
+    bool read_double_slow( const string_view& view, double& value ) {
+        std::string buffer = view.string();
+        std::replace_if( buffer.begin(), buffer.end(),
+                         []( char c ) { return c == 'd' || c == 'D'; }, 'e' );
+
+        std::istringstream stream( buffer );
+        stream.imbue( std::locale::classic() );
+        stream >> value;
+        return !stream.fail();
+    }
+
+    /*
+      Parse a floating point number with an optional Fortran exponent. The
+      significant digits are accumulated in an integer and scaled by an exact
+      power of ten when both are exactly representable, which gives the
+      correctly rounded result without going through strtod().
+    */
+    bool read_double( const string_view& view, double& value ) {
+        static const std::array< double, 23 > powers_of_ten = {{
+            1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+            1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        }};
+        const int max_digits = 19;
+
+        auto cursor = view.begin();
+        const auto end = view.end();
+
+        bool negative = false;
+        if( cursor != end && ( *cursor == '+' || *cursor == '-' ) ) {
+            negative = *cursor == '-';
+            ++cursor;
+        }
+
+        if( cursor != end && !is_digit( *cursor ) && *cursor != '.' ) {
+            if( match_nocase( cursor, end, "nan" ) && cursor == end ) {
+                value = std::numeric_limits< double >::quiet_NaN();
+                return true;
+            }
+
+            if( match_nocase( cursor, end, "inf" ) ) {
+                match_nocase( cursor, end, "inity" );
+                if( cursor != end )
+                    return false;
+
+                value = negative ? -std::numeric_limits< double >::infinity()
+                                 :  std::numeric_limits< double >::infinity();
+                return true;
+            }
+
+            return false;
+        }
+
+        std::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        bool truncated = false;
+        bool any_digits = false;
+
+        for( ; cursor != end && is_digit( *cursor ); ++cursor ) {
+            any_digits = true;
+            if( digits < max_digits ) {
+                mantissa = 10 * mantissa + ( *cursor - '0' );
+                if( mantissa > 0 )
+                    digits += 1;
+            } else {
+                truncated |= ( *cursor != '0' );
+                exponent += 1;
+            }
+        }
+
+        if( cursor != end && *cursor == '.' ) {
+            ++cursor;
+            for( ; cursor != end && is_digit( *cursor ); ++cursor ) {
+                any_digits = true;
+                if( digits < max_digits ) {
+                    mantissa = 10 * mantissa + ( *cursor - '0' );
+                    if( mantissa > 0 )
+                        digits += 1;
+                    exponent -= 1;
+                } else
+                    truncated |= ( *cursor != '0' );
+            }
+        }
+
+        if( !any_digits )
+            return false;
+
+        if( cursor != end && is_exponent( *cursor ) ) {
+            ++cursor;
+            bool negative_exponent = false;
+            if( cursor != end && ( *cursor == '+' || *cursor == '-' ) ) {
+                negative_exponent = *cursor == '-';
+                ++cursor;
+            }
+
+            if( cursor == end )
                 return false;
-            ++first;
+
+            int exp_value = 0;
+            for( ; cursor != end; ++cursor ) {
+                if( !is_digit( *cursor ) )
+                    return false;
+
+                if( exp_value < 100000 )
+                    exp_value = 10 * exp_value + ( *cursor - '0' );
+            }
+            exponent += negative_exponent ? -exp_value : exp_value;
+        }
+
+        if( cursor != end )
+            return false;
+
+        if( mantissa == 0 ) {
+            value = negative ? -0.0 : 0.0;
             return true;
         }
-    };
+
+        if( truncated || mantissa > ( std::uint64_t( 1 ) << 53 ) || exponent < -22 || exponent > 22 )
+            return read_double_slow( view, value );
+
+        value = static_cast< double >( mantissa );
+        if( exponent < 0 )
+            value /= powers_of_ten[ -exponent ];
+        else
+            value *= powers_of_ten[ exponent ];
+
+        if( negative )
+            value = -value;
+
+        return true;
+    }
+
+}
+
+    template<>
+    int readValueToken< int >( string_view view ) {
+        int n = 0;
+        if( read_int( view, n ) ) return n;
+        throw std::invalid_argument( "Malformed integer '" + view + "'" );
+    }
 
     template<>
     double readValueToken< double >( string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return n;
+        if( read_double( view, n ) ) return n;
         throw std::invalid_argument( "Malformed floating point number '" + view + "'" );
     }
 
@@ -122,11 +294,7 @@ namespace Opm {
     template<>
     UDAValue readValueToken< UDAValue >( string_view view ) {
         double n = 0;
-        qi::real_parser< double, fortran_double< double > > double_;
-        auto cursor = view.begin();
-        const auto ok = qi::parse( cursor, view.end(), double_, n );
-
-        if( ok && cursor == view.end() ) return UDAValue(n);
+        if( read_double( view, n ) ) return UDAValue(n);
         return UDAValue( readValueToken<std::string>(view) );
     }
 
@@ -904,6 +904,11 @@ void ECLRegressionTest::results_smry()
              
             std::cout << "\nChecking " << keywords1.size() << "  vectors  ... ";
 
+            // all vectors are compared, load them in one pass through the summary files
+
+            smry1.loadData(keywords1);
+            smry2.loadData(keywords1);
+
             for (size_t i = 0; i < keywords1.size(); i++) {
 
                 std::vector<float> vect1;
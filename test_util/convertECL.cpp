@@ -6,6 +6,7 @@
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 
 using namespace Opm::EclIO;
@@ -77,7 +78,8 @@ static void printHelp() {
               << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
               << "-h Print help and exit.\n"
               << "-l list report step numbers in the selected restart file.\n"
-              << "-r extract and convert a spesific report time step number from a unified restart file. \n\n";
+              << "-r extract and convert a spesific report time step number from a unified restart file. \n"
+              << "-t create transposed summary file (LODSMRY) from a summary specification file (*.SMSPEC or *.FSMSPEC). \n\n";
 }
 
 int main(int argc, char **argv) {
@@ -86,8 +88,9 @@ int main(int argc, char **argv) {
     int reportStepNumber           = -1;
     bool specificReportStepNumber  = false;
     bool listProperties            = false;
+    bool transposedSummary         = false;
 
-    while ((c = getopt(argc, argv, "hr:l")) != -1) {
+    while ((c = getopt(argc, argv, "hr:lt")) != -1) {
         switch (c) {
         case 'h':
             printHelp();
@@ -99,6 +102,9 @@ int main(int argc, char **argv) {
             specificReportStepNumber=true;
             reportStepNumber = atoi(optarg);
             break;
+        case 't':
+            transposedSummary=true;
+            break;
         default:
             return EXIT_FAILURE;
         }
@@ -149,6 +155,26 @@ int main(int argc, char **argv) {
         return 0;
     }
 
+    if (transposedSummary) {
+
+        if ((extension!=".SMSPEC") && (extension!=".FSMSPEC")) {
+            std::cout << "\n!ERROR, option -t only available for summary specification files (*.SMSPEC or *.FSMSPEC) " << std::endl;
+            exit(1);
+        }
+
+        std::cout << "\033[1;31m" << "\nconverting  " << argv[argOffset] << " -> " << rootN + ".LODSMRY" << "\033[0m\n" << std::endl;
+
+        ESmry smry1(filename);
+        smry1.make_lodsmry_file();
+
+        auto end = std::chrono::system_clock::now();
+        std::chrono::duration<double> elapsed_seconds = end-start;
+
+        std::cout << "runtime  : " << argv[argOffset] << ": " << elapsed_seconds.count() << " seconds\n" << std::endl;
+
+        return 0;
+    }
+
     std::map<std::string, std::string> to_formatted = {{".EGRID", ".FEGRID"}, {".INIT", ".FINIT"}, {".SMSPEC", ".FSMSPEC"}, 
         {".UNSMRY", ".FUNSMRY"}, {".UNRST", ".FUNRST"}, {".RFT", ".FRFT"}};
 
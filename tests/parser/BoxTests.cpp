@@ -203,3 +203,14 @@ BOOST_AUTO_TEST_CASE(TestKeywordBox2) {
         BOOST_CHECK_EQUAL(il[i].active_index, 98 + i*100);
     }
 }
+
+BOOST_AUTO_TEST_CASE(ForEachIndex) {
+    Opm::EclipseGrid grid(10,7,6);
+    for (const auto& box : { Opm::Box(grid), Opm::Box(grid,1,3,2,5,0,4), Opm::Box(grid,9,9,6,6,5,5) }) {
+        std::vector<size_t> indices;
+        box.forEachIndex([&indices](size_t g) { indices.push_back(g); });
+        const auto& indexList = box.getIndexList();
+        BOOST_CHECK_EQUAL_COLLECTIONS( indices.begin(), indices.end(), indexList.begin(), indexList.end() );
+        BOOST_CHECK_EQUAL( indices.size(), box.size() );
+    }
+}
@@ -0,0 +1,263 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fstream>
+#include <string>
+
+#define BOOST_TEST_MODULE DeckCacheTests
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <opm/json/JsonObject.hpp>
+#include <opm/parser/eclipse/Deck/Deck.hpp>
+#include <opm/parser/eclipse/Deck/DeckCache.hpp>
+#include <opm/parser/eclipse/Deck/DeckItem.hpp>
+#include <opm/parser/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/parser/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/parser/eclipse/Parser/ParseContext.hpp>
+#include <opm/parser/eclipse/Parser/Parser.hpp>
+#include <opm/parser/eclipse/Units/UnitSystem.hpp>
+
+#include <tests/WorkArea.cpp>
+
+using namespace Opm;
+
+namespace {
+
+void writeFile(const std::string& filename, const std::string& content) {
+    std::ofstream os(filename);
+    os << content;
+}
+
+const std::string deck_string = R"(
+RUNSPEC
+FIELD
+DIMENS
+ 2 2 1 /
+GRID
+INCLUDE
+ 'PROPS.INC' /
+SCHEDULE
+WELSPECS
+ 'PROD' 'G1' 1 1 1* 'OIL' /
+/
+WCONPROD
+ 'PROD' 'OPEN' 'ORAT' 'UDQ1' 4* 1000 /
+/
+)";
+
+const std::string props_string = R"(
+PORO
+ 0.25 2*0.5 1* /
+ACTNUM
+ 3*1 0 /
+)";
+
+void checkEqual(const Deck& deck1, const Deck& deck2) {
+    BOOST_CHECK_EQUAL(deck1.size(), deck2.size());
+    for (std::size_t index = 0; index < deck1.size(); index++) {
+        const auto& kw1 = deck1.getKeyword(index);
+        const auto& kw2 = deck2.getKeyword(index);
+        BOOST_CHECK(kw1.equal(kw2, true, false));
+        BOOST_CHECK_EQUAL(kw1.location().filename, kw2.location().filename);
+        BOOST_CHECK_EQUAL(kw1.location().lineno, kw2.location().lineno);
+        BOOST_CHECK_EQUAL(kw1.isDataKeyword(), kw2.isDataKeyword());
+    }
+    BOOST_CHECK(deck1.getActiveUnitSystem().getType() == deck2.getActiveUnitSystem().getType());
+    BOOST_CHECK_EQUAL(deck1.getDataFile(), deck2.getDataFile());
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad) {
+    WorkArea work_area;
+    writeFile("CASE.DATA", deck_string);
+    writeFile("PROPS.INC", props_string);
+
+    Parser plain_parser;
+    const auto plain_deck = plain_parser.parseFile("CASE.DATA");
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+    BOOST_CHECK_EQUAL(parser.deckCacheDirectory(), "cache");
+
+    const DeckCache cache("cache", "CASE.DATA");
+    BOOST_CHECK(!boost::filesystem::exists(cache.fileName()));
+
+    const auto deck1 = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(boost::filesystem::exists(cache.fileName()));
+    checkEqual(plain_deck, deck1);
+
+    {
+        Deck cached_deck;
+        BOOST_CHECK(cache.load(parser, ParseContext(), cached_deck));
+        BOOST_CHECK_EQUAL(cached_deck.size(), plain_deck.size());
+    }
+
+    const auto deck2 = Parser().parseFile("CASE.DATA");
+    Parser cached_parser;
+    cached_parser.setDeckCacheDirectory("cache");
+    const auto deck3 = cached_parser.parseFile("CASE.DATA");
+    checkEqual(deck2, deck3);
+
+    const auto& poro = deck3.getKeyword("PORO").getRecord(0).getItem(0);
+    BOOST_CHECK_EQUAL(poro.size(), 4U);
+    BOOST_CHECK(poro.defaultApplied(3));
+    BOOST_CHECK_EQUAL(poro.get<double>(1), 0.5);
+
+    const auto& orat = deck3.getKeyword("WCONPROD").getRecord(0).getItem("ORAT");
+    BOOST_CHECK(orat.get<UDAValue>(0).is<std::string>());
+    BOOST_CHECK_EQUAL(orat.get<UDAValue>(0).get<std::string>(), "UDQ1");
+
+    const auto& bhp = deck3.getKeyword("WCONPROD").getRecord(0).getItem("BHP");
+    const auto& plain_bhp = plain_deck.getKeyword("WCONPROD").getRecord(0).getItem("BHP");
+    BOOST_CHECK_EQUAL(bhp.get<UDAValue>(0).get<double>(), plain_bhp.get<UDAValue>(0).get<double>());
+    BOOST_CHECK(bhp.get<UDAValue>(0).get_dim().equal(plain_bhp.get<UDAValue>(0).get_dim()));
+}
+
+BOOST_AUTO_TEST_CASE(Invalidation) {
+    WorkArea work_area;
+    writeFile("CASE.DATA", deck_string);
+    writeFile("PROPS.INC", props_string);
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+    const DeckCache cache("cache", "CASE.DATA");
+
+    parser.parseFile("CASE.DATA");
+    {
+        Deck deck;
+        BOOST_CHECK(cache.load(parser, ParseContext(), deck));
+    }
+
+    // Rewriting a file with the same content keeps the cache valid.
+    writeFile("PROPS.INC", props_string);
+    {
+        Deck deck;
+        BOOST_CHECK(cache.load(parser, ParseContext(), deck));
+    }
+
+    // A different parse context invalidates the cache.
+    {
+        Deck deck;
+        const ParseContext context(InputError::IGNORE);
+        BOOST_CHECK(!cache.load(parser, context, deck));
+    }
+
+    // A different definition of a keyword invalidates the cache, also when
+    // the number of keywords is unchanged.
+    {
+        Parser other_parser;
+        other_parser.addParserKeyword(Json::JsonObject(std::string(R"({"name" : "PORO", "sections" : ["GRID"], "data" : {"value_type" : "DOUBLE", "default" : 1}})")));
+        BOOST_CHECK_EQUAL(other_parser.size(), parser.size());
+
+        Deck deck;
+        BOOST_CHECK(cache.load(Parser(), ParseContext(), deck));
+        BOOST_CHECK(!cache.load(other_parser, ParseContext(), deck));
+    }
+
+    // Changing an include file invalidates the cache, and the next parse
+    // reads the new content and updates the cache.
+    writeFile("PROPS.INC", R"(
+PORO
+ 0.25 2*0.5 0.75 /
+ACTNUM
+ 3*1 0 /
+)");
+    {
+        Deck deck;
+        BOOST_CHECK(!cache.load(parser, ParseContext(), deck));
+    }
+    {
+        const auto deck = parser.parseFile("CASE.DATA");
+        BOOST_CHECK_EQUAL(deck.getKeyword("PORO").getRecord(0).getItem(0).get<double>(3), 0.75);
+    }
+    {
+        Deck deck;
+        BOOST_CHECK(cache.load(parser, ParseContext(), deck));
+        BOOST_CHECK_EQUAL(deck.getKeyword("PORO").getRecord(0).getItem(0).get<double>(3), 0.75);
+    }
+
+    // Changing the DATA file invalidates the cache.
+    writeFile("CASE.DATA", deck_string + "\nEND\n");
+    {
+        Deck deck;
+        BOOST_CHECK(!cache.load(parser, ParseContext(), deck));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(MissingInclude) {
+    WorkArea work_area;
+    writeFile("CASE.DATA", R"(
+RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+INCLUDE
+ 'MISSING.INC' /
+)");
+
+    ParseContext context;
+    context.update(ParseContext::PARSE_MISSING_INCLUDE, InputError::IGNORE);
+    ErrorGuard errors;
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+    const DeckCache cache("cache", "CASE.DATA");
+
+    const auto deck1 = parser.parseFile("CASE.DATA", context, errors);
+    BOOST_CHECK(!deck1.hasKeyword("PORO"));
+    {
+        Deck deck;
+        BOOST_CHECK(cache.load(parser, context, deck));
+    }
+
+    // The include file appearing invalidates the cache.
+    writeFile("MISSING.INC", props_string);
+    {
+        Deck deck;
+        BOOST_CHECK(!cache.load(parser, context, deck));
+    }
+
+    const auto deck2 = parser.parseFile("CASE.DATA", context, errors);
+    BOOST_CHECK(deck2.hasKeyword("PORO"));
+}
+
+BOOST_AUTO_TEST_CASE(DamagedCacheFile) {
+    WorkArea work_area;
+    writeFile("CASE.DATA", deck_string);
+    writeFile("PROPS.INC", props_string);
+
+    Parser parser;
+    parser.setDeckCacheDirectory("cache");
+    const DeckCache cache("cache", "CASE.DATA");
+    const auto deck1 = parser.parseFile("CASE.DATA");
+
+    const auto size = boost::filesystem::file_size(cache.fileName());
+    boost::filesystem::resize_file(cache.fileName(), size - 16);
+    {
+        Deck deck;
+        BOOST_CHECK(!cache.load(parser, ParseContext(), deck));
+    }
+
+    const auto deck2 = parser.parseFile("CASE.DATA");
+    checkEqual(deck1, deck2);
+    BOOST_CHECK_EQUAL(boost::filesystem::file_size(cache.fileName()), size);
+}
@@ -334,3 +334,30 @@ BOOST_AUTO_TEST_CASE( UNIQUE ) {
     BOOST_CHECK(unique1[2] == std::make_pair(std::size_t{6}, 600));
 }
 
+
+
+BOOST_AUTO_TEST_CASE( UPDATE_MIDDLE ) {
+    const std::time_t startDate = Opm::TimeMap::mkdate(2010, 1, 1);
+    Opm::TimeMap timeMap{ startDate };
+    for (size_t i = 0; i < 10; i++)
+        timeMap.addTStep((i+1) * 24 * 60 * 60);
+
+    Opm::DynamicState<int> state(timeMap , 13);
+    state.update(3,300);
+    state.update(6,600);
+
+    // Updating before the last change point overwrites the tail.
+    BOOST_CHECK( state.update(5,500) );
+    BOOST_CHECK( !state.update(8,500) );
+    BOOST_CHECK_EQUAL(state[4], 300);
+    BOOST_CHECK_EQUAL(state[6], 500);
+    BOOST_CHECK_EQUAL(state[10], 500);
+
+    state.update_elm(4, 13);
+    state.update_elm(3, 13);
+    auto unique = state.unique();
+    BOOST_CHECK_EQUAL(unique.size(), 2);
+    BOOST_CHECK(unique[0] == std::make_pair(std::size_t{0}, 13));
+    BOOST_CHECK(unique[1] == std::make_pair(std::size_t{5}, 500));
+    BOOST_CHECK_THROW( state.get(11), std::out_of_range );
+}
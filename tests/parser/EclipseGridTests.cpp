@@ -2816,3 +2816,48 @@ BOOST_AUTO_TEST_CASE(TEST_COLLAPSED_CELL) {
     for (std::size_t g = 0; g < grid.getCartesianSize(); g++)
         BOOST_CHECK_EQUAL(grid.getCellVolume(g), 0);
 }
+
+BOOST_AUTO_TEST_CASE(TEST_LAZY_GEOMETRY) {
+    Opm::Deck deck = BAD_CP_GRID_ACTNUM();
+    const Opm::EclipseGrid grid(deck);
+    const Opm::EclipseGrid copy_before(grid);
+
+    Opm::EclipseGrid precomputed(deck);
+    precomputed.precomputeGeometry(2);
+    const Opm::EclipseGrid copy_after(precomputed);
+
+    std::array<int, 3> dims = grid.getNXYZ();
+    const Opm::EclipseGrid from_coord(dims, grid.getCOORD(), grid.getZCORN());
+
+    const std::vector<const Opm::EclipseGrid*> others = { &copy_before, &precomputed, &copy_after, &from_coord };
+    for (std::size_t g = grid.getCartesianSize(); g-- > 0; ) {
+        const double volume = grid.getCellVolume(g);
+        const auto center = grid.getCellCenter(g);
+        const auto cell_dims = grid.getCellDims(g);
+        const double depth = grid.getCellDepth(g);
+
+        for (const auto* other : others) {
+            BOOST_CHECK_EQUAL(volume, other->getCellVolume(g));
+            BOOST_CHECK(center == other->getCellCenter(g));
+            BOOST_CHECK(cell_dims == other->getCellDims(g));
+            BOOST_CHECK_EQUAL(depth, other->getCellDepth(g));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TEST_LAZY_GEOMETRY_BLOCKS) {
+    // More than one geometry block, accessed from several threads.
+    Opm::EclipseGrid grid(100, 200, 10, 1.0, 2.0, 3.0);
+    std::vector<double> volumes(grid.getCartesianSize());
+
+#pragma omp parallel for
+    for (std::size_t g = 0; g < volumes.size(); g++)
+        volumes[g] = grid.getCellVolume(volumes.size() - 1 - g);
+
+    for (const auto& volume : volumes)
+        BOOST_CHECK_CLOSE(volume, 6.0, 1e-10);
+
+    BOOST_CHECK_CLOSE(grid.getCellDepth(99, 199, 9), 28.5, 1e-10);
+    BOOST_CHECK_CLOSE(grid.getCellCenter(99, 199, 9)[0], 99.5, 1e-10);
+    BOOST_CHECK(grid.getCellCenter(99, 199, 9) == grid.getCellCenter(grid.getCartesianSize() - 1));
+}
@@ -520,6 +520,49 @@ BOOST_AUTO_TEST_CASE(mask_test) {
     BOOST_CHECK(d1 == d2);
 }
 
+BOOST_AUTO_TEST_CASE(region_index_test) {
+    typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
+    SupportedKeywordInfo regionInfo("R" , 1 , "1");
+    SupportedKeywordInfo keywordInfo("P" , 0 , "1");
+    Opm::GridProperty<int> region( 5 , 5 , 4 , regionInfo);
+    Opm::GridProperty<int> p1( 5 , 5 , 4 , keywordInfo);
+    Opm::GridProperty<int> p2( 5 , 5 , 4 , keywordInfo);
+
+    {
+        std::vector<int> data(region.getCartesianSize());
+        for (size_t g = 0; g < data.size(); g++)
+            data[g] = 1 + (g / 7) % 3;
+        region.assignData(data);
+    }
+
+    for (int value = 0; value <= 4; value++) {
+        std::vector<bool> mask;
+        region.initMask(value, mask);
+        BOOST_CHECK( region.regionIndex(value) == region.indexEqual(value) );
+
+        p1.maskedAdd( value, mask );
+        p2.maskedAdd( value, region.regionIndex(value) );
+        p1.maskedMultiply( value + 1, mask );
+        p2.maskedMultiply( value + 1, region.regionIndex(value) );
+    }
+    BOOST_CHECK( p1.getData() == p2.getData() );
+    BOOST_CHECK( region.regionIndex(4).empty() );
+
+    // Modifying the region property invalidates the index.
+    const auto cells = region.regionIndex(2);
+    region.maskedSet( 4, region.regionIndex(2) );
+    BOOST_CHECK( region.regionIndex(2).empty() );
+    BOOST_CHECK( region.regionIndex(4) == cells );
+
+    region.multiplyValueAtIndex( cells[0], 2 );
+    BOOST_CHECK_EQUAL( region.regionIndex(4).size(), cells.size() - 1 );
+    BOOST_CHECK_EQUAL( region.regionIndex(8).size(), 1U );
+
+    p1.maskedOperate( [](double x, double y) { return x + 2*y; }, region, region.regionIndex(1) );
+    for (const auto g : region.regionIndex(1))
+        BOOST_CHECK_EQUAL( p1.getData()[g], p2.getData()[g] + 2 );
+}
+
 BOOST_AUTO_TEST_CASE(CheckLimits) {
     typedef Opm::GridProperty<int>::SupportedKeywordInfo SupportedKeywordInfo;
     SupportedKeywordInfo keywordInfo1("P" , 1 , "1");
@@ -311,3 +311,76 @@ BOOST_AUTO_TEST_CASE(MULTREGT_COPY_MULTNUM) {
         BOOST_CHECK_EQUAL(fdata[i], data[i]);
     }
 }
+
+
+BOOST_AUTO_TEST_CASE(BatchedRegionMultipliers) {
+  Opm::Deck deck = createDefaultedRegions();
+  Opm::EclipseGrid grid( deck );
+  Opm::TableManager tm(deck);
+  Opm::Eclipse3DProperties props(deck, tm, grid);
+
+  std::vector<const Opm::DeckKeyword*> keywords;
+  for (const auto* kw : deck.getKeywordList("MULTREGT"))
+      keywords.push_back( kw );
+  Opm::MULTREGTScanner scanner(props, keywords);
+
+  std::vector<Opm::MULTREGTFace> faces;
+  for (size_t g1 = 0; g1 < grid.getCartesianSize(); g1++) {
+      for (size_t g2 = 0; g2 < grid.getCartesianSize(); g2++) {
+          for (auto dir : {Opm::FaceDir::XPlus, Opm::FaceDir::XMinus, Opm::FaceDir::YPlus,
+                           Opm::FaceDir::YMinus, Opm::FaceDir::ZPlus, Opm::FaceDir::ZMinus})
+              faces.push_back({g1, g2, dir});
+      }
+  }
+
+  std::vector<double> multipliers;
+  scanner.getRegionMultipliers(faces, multipliers);
+  BOOST_REQUIRE_EQUAL( multipliers.size(), faces.size() );
+  for (size_t index = 0; index < faces.size(); index++) {
+      const auto& face = faces[index];
+      BOOST_CHECK_EQUAL( multipliers[index], scanner.getRegionMultiplier(face.global_index1, face.global_index2, face.face_dir) );
+  }
+  BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(0,0,1), grid.getGlobalIndex(1,0,1), Opm::FaceDir::XPlus ), 1.25);
+  BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(grid.getGlobalIndex(2,0,0), grid.getGlobalIndex(1,0,0), Opm::FaceDir::XMinus ), 0.75);
+}
+
+
+BOOST_AUTO_TEST_CASE(SparseRegionValues) {
+    // The region values span too wide a range for a dense lookup matrix.
+    const char* deckData =
+        "RUNSPEC\n"
+        "DIMENS\n"
+        " 3 1 1 /\n"
+        "GRID\n"
+        "DX\n"
+        "3*0.25 /\n"
+        "DY\n"
+        "3*0.25 /\n"
+        "DZ\n"
+        "3*0.25 /\n"
+        "TOPS\n"
+        "3*0.25 /\n"
+        "MULTNUM\n"
+        "1 5000 7 /\n"
+        "MULTREGT\n"
+        "1  5000   0.50   X   ALL    M /\n"
+        "5000  7   0.25   Y   ALL    M /\n"
+        "/\n"
+        "EDIT\n"
+        "\n";
+
+    Opm::Parser parser;
+    Opm::Deck deck = parser.parseString(deckData);
+    Opm::EclipseGrid grid( deck );
+    Opm::TableManager tm(deck);
+    Opm::Eclipse3DProperties props(deck, tm, grid);
+
+    std::vector<const Opm::DeckKeyword*> keywords = { &deck.getKeyword("MULTREGT") };
+    Opm::MULTREGTScanner scanner(props, keywords);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(0, 1, Opm::FaceDir::XPlus), 0.50);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(1, 0, Opm::FaceDir::XMinus), 0.50);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(0, 1, Opm::FaceDir::YPlus), 1.0);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(1, 2, Opm::FaceDir::XPlus), 1.0);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(2, 1, Opm::FaceDir::YMinus), 0.25);
+    BOOST_CHECK_EQUAL( scanner.getRegionMultiplier(0, 2, Opm::FaceDir::XPlus), 1.0);
+}
@@ -0,0 +1,68 @@
+/*
+  Copyright 2019 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <fnmatch.h>
+
+#define BOOST_TEST_MODULE NameIndexTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/parser/eclipse/EclipseState/Util/NameIndex.hpp>
+
+
+BOOST_AUTO_TEST_CASE( pattern_fnmatch ) {
+    const std::vector<std::string> patterns = {"OP*", "*", "OP_?", "*_1", "O*_*1", "*P*", "OP", "OP_[12]", "OP\\_1", "**1", "?*?", "INJ*"};
+    const std::vector<std::string> names = {"OP", "OP_1", "OP_2", "OP_11", "OPX_21", "INJ_1", "P", "", "OOP_1", "_1"};
+
+    for (const auto& pattern_string : patterns) {
+        Opm::NamePattern pattern(pattern_string);
+        for (const auto& name : names)
+            BOOST_CHECK_MESSAGE( pattern.match(name) == (fnmatch(pattern_string.c_str(), name.c_str(), 0) == 0),
+                                 "Pattern: " << pattern_string << " name: " << name );
+    }
+
+    BOOST_CHECK( !Opm::NamePattern("OP_1").wildcard() );
+    BOOST_CHECK( Opm::NamePattern("OP_?").wildcard() );
+    BOOST_CHECK_EQUAL( Opm::NamePattern("OP_*1").prefix(), "OP_" );
+    BOOST_CHECK_EQUAL( Opm::NamePattern("*1").prefix(), "" );
+}
+
+
+BOOST_AUTO_TEST_CASE( index_match ) {
+    Opm::NameIndex index;
+    BOOST_CHECK( index.match("*").empty() );
+
+    BOOST_CHECK_EQUAL( index.add("PROD2"), 0U );
+    BOOST_CHECK_EQUAL( index.add("INJ1"), 1U );
+    BOOST_CHECK_EQUAL( index.add("PROD1"), 2U );
+    BOOST_CHECK_EQUAL( index.add("PRO"), 3U );
+    BOOST_CHECK_EQUAL( index.add("INJ1"), 1U );
+    BOOST_CHECK_EQUAL( index.size(), 4U );
+    BOOST_CHECK( index.has("PRO") );
+    BOOST_CHECK( !index.has("PROD") );
+
+    // The matches are in the order the names were added.
+    BOOST_CHECK( index.match("PROD*") == std::vector<std::size_t>({0, 2}) );
+    BOOST_CHECK( index.match("PRO*") == std::vector<std::size_t>({0, 2, 3}) );
+    BOOST_CHECK( index.match("*1") == std::vector<std::size_t>({1, 2}) );
+    BOOST_CHECK( index.match("*") == std::vector<std::size_t>({0, 1, 2, 3}) );
+    BOOST_CHECK( index.match("PROD?") == std::vector<std::size_t>({0, 2}) );
+    BOOST_CHECK( index.match("INJ1") == std::vector<std::size_t>({1}) );
+    BOOST_CHECK( index.match("INJ2").empty() );
+    BOOST_CHECK( index.match("Q*").empty() );
+}
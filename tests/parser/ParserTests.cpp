@@ -18,6 +18,9 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <sstream>
+#include <thread>
+
 #include <boost/test/unit_test.hpp>
 
 #include <opm/json/JsonObject.hpp>
@@ -166,6 +169,32 @@ BOOST_AUTO_TEST_CASE(empty_sizeReturns0) {
     BOOST_CHECK_EQUAL( 0U , parser.size());
 }
 
+BOOST_AUTO_TEST_CASE(lazyKeyword_createdOnceOnLookup) {
+    static int created = 0;
+    Parser parser( false );
+    parser.addLazyKeyword( { "LAZYA", "LAZYB" }, []() {
+        created += 1;
+        return createFixedSized( "LAZYA", (size_t) 1 );
+    });
+
+    BOOST_CHECK_EQUAL( 2U , parser.size() );
+    BOOST_CHECK( parser.hasKeyword( "LAZYA" ) );
+    BOOST_CHECK( parser.isRecognizedKeyword( "LAZYB" ) );
+    BOOST_CHECK_EQUAL( 0 , created );
+
+    const auto& kwA = parser.getKeyword( "LAZYA" );
+    const auto& kwB = parser.getParserKeywordFromDeckName( "LAZYB" );
+    BOOST_CHECK_EQUAL( 1 , created );
+    BOOST_CHECK_EQUAL( &kwA , &kwB );
+    BOOST_CHECK_EQUAL( "LAZYA" , kwA.getName() );
+
+    parser.addParserKeyword( createFixedSized( "LAZYB", (size_t) 2 ) );
+    BOOST_CHECK_EQUAL( 2U , parser.size() );
+    BOOST_CHECK_EQUAL( 2U , parser.getKeyword( "LAZYB" ).getFixedSize() );
+    BOOST_CHECK_EQUAL( &kwA , &parser.getKeyword( "LAZYA" ) );
+    BOOST_CHECK_EQUAL( 1 , created );
+}
+
 
 
 BOOST_AUTO_TEST_CASE(loadKeywordsJSON_manyKeywords_returnstrue) {
@@ -295,6 +324,32 @@ BOOST_AUTO_TEST_CASE(WildCardTest) {
     BOOST_CHECK_EQUAL( keyword1 , keyword3 );
 }
 
+BOOST_AUTO_TEST_CASE(WildCardLeadingCharacters) {
+    Parser parser(false);
+
+    auto grouped = createFixedSized("GROUPED", (size_t) 1);
+    grouped.clearDeckNames();
+    grouped.setMatchRegex("XA.+|(YB|Z[C-E])[1-9]");
+    parser.addParserKeyword( std::move(grouped) );
+
+    auto optional = createFixedSized("OPTIONAL", (size_t) 1);
+    optional.clearDeckNames();
+    optional.setMatchRegex("Q?RS.+");
+    parser.addParserKeyword( std::move(optional) );
+
+    BOOST_CHECK( parser.isRecognizedKeyword("XAB") );
+    BOOST_CHECK( parser.isRecognizedKeyword("YB1") );
+    BOOST_CHECK( parser.isRecognizedKeyword("ZD9") );
+    BOOST_CHECK( !parser.isRecognizedKeyword("ZF9") );
+    BOOST_CHECK( !parser.isRecognizedKeyword("XA") );
+    BOOST_CHECK_EQUAL( parser.getParserKeywordFromDeckName("ZC2").getName(), "GROUPED" );
+
+    BOOST_CHECK( parser.isRecognizedKeyword("QRSX") );
+    BOOST_CHECK( parser.isRecognizedKeyword("RSX") );
+    BOOST_CHECK_EQUAL( parser.getParserKeywordFromDeckName("RSX").getName(), "OPTIONAL" );
+    BOOST_CHECK_THROW( parser.getParserKeywordFromDeckName("ABC"), std::invalid_argument );
+}
+
 
 BOOST_AUTO_TEST_CASE( quoted_comments ) {
     BOOST_CHECK_EQUAL( Parser::stripComments( "ABC" ) , "ABC");
@@ -2121,3 +2176,116 @@ DENSITY
 }
 
 
+
+BOOST_AUTO_TEST_CASE(DeferredDataKeywords) {
+    const std::string input = R"(
+RUNSPEC
+DIMENS
+ 2 2 1 /
+GRID
+PORO
+ 0.25 2*0.5
+ 1D-1 /
+ACTNUM
+ 3*1 0 /
+)";
+
+    Parser parser;
+    Parser deferred_parser;
+    deferred_parser.deferDataKeywords(true);
+    BOOST_CHECK( deferred_parser.deferredDataKeywords() );
+
+    const auto deck = parser.parseString( input );
+    const auto deferred = deferred_parser.parseString( input );
+
+    const auto& poro = deferred.getKeyword( "PORO" ).getRecord( 0 ).getItem( 0 );
+    const auto& actnum = deferred.getKeyword( "ACTNUM" ).getRecord( 0 ).getItem( 0 );
+    BOOST_CHECK( !poro.loaded() );
+    BOOST_CHECK( !actnum.loaded() );
+    BOOST_CHECK( deferred.getKeyword( "DIMENS" ).getRecord( 0 ).getItem( 0 ).loaded() );
+
+    BOOST_CHECK_EQUAL( 4U, poro.size() );
+    BOOST_CHECK( poro.loaded() );
+    BOOST_CHECK_EQUAL( 0.5, poro.get< double >( 1 ) );
+    BOOST_CHECK_EQUAL( 0.1, poro.getSIDouble( 3 ) );
+
+    const std::vector< int > expected_actnum = { 1, 1, 1, 0 };
+    BOOST_CHECK( actnum.getData< int >() == expected_actnum );
+
+    BOOST_CHECK( deck.getKeyword( "PORO" ).equal( deferred.getKeyword( "PORO" ), true ) );
+    BOOST_CHECK( deck.getKeyword( "ACTNUM" ).equal( deferred.getKeyword( "ACTNUM" ), true ) );
+}
+
+BOOST_AUTO_TEST_CASE(DeferredDataKeywordsChunked) {
+    std::string input = "PERMX\n";
+    for (int i = 0; i < 300000; i++)
+        input += std::to_string( i ) + ".5 3*" + std::to_string( i % 7 ) + "\n";
+    input += "/\n";
+
+    Parser parser;
+    Parser deferred_parser;
+    deferred_parser.deferDataKeywords(true);
+
+    const auto deck = parser.parseString( input );
+    const auto deferred = deferred_parser.parseString( input );
+
+    const auto& item = deck.getKeyword( "PERMX" ).getRecord( 0 ).getItem( 0 );
+    const auto& deferred_item = deferred.getKeyword( "PERMX" ).getRecord( 0 ).getItem( 0 );
+    BOOST_CHECK_EQUAL( 1200000U, deferred_item.size() );
+    BOOST_CHECK( item.getData< double >() == deferred_item.getData< double >() );
+    const auto raw_data = item.getData< double >();
+    BOOST_CHECK( item.getSIDoubleData() == deferred_item.getSIDoubleData() );
+
+    // Concurrent first access loads the item once.
+    const auto concurrent = deferred_parser.parseString( input );
+    const auto& concurrent_item = concurrent.getKeyword( "PERMX" ).getRecord( 0 ).getItem( 0 );
+    std::vector< int > equal_data( 4, 0 );
+    std::vector< std::thread > threads;
+    for (std::size_t t = 0; t < equal_data.size(); t++)
+        threads.emplace_back( [&concurrent_item, &raw_data, &equal_data, t]() {
+            equal_data[t] = ( concurrent_item.size() == 1200000U ) && ( raw_data == concurrent_item.getData< double >() );
+        } );
+
+    for (auto& thread : threads)
+        thread.join();
+
+    BOOST_CHECK( concurrent_item.loaded() );
+    for (const auto& eq : equal_data)
+        BOOST_CHECK( eq );
+}
+
+BOOST_AUTO_TEST_CASE(DeferredDataKeywordsMalformed) {
+    const std::string input = "PORO\n 0.25 X /\n";
+
+    Parser parser;
+    parser.deferDataKeywords(true);
+
+    const auto deck = parser.parseString( input );
+    const auto& poro = deck.getKeyword( "PORO" ).getRecord( 0 ).getItem( 0 );
+    BOOST_CHECK_THROW( poro.size(), std::invalid_argument );
+    BOOST_CHECK( !poro.loaded() );
+    BOOST_CHECK_THROW( poro.get< double >( 0 ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE(DeferredDataKeywordsWrite) {
+    const std::string input = R"(
+PORO
+ 0.25    2*0.5
+ 1D-1 /
+)";
+
+    Parser parser;
+    parser.deferDataKeywords(true);
+
+    const auto deck = parser.parseString( input );
+    const auto& keyword = deck.getKeyword( "PORO" );
+
+    // Writing the keyword copies the text, and does not load the item.
+    std::stringstream ss;
+    ss << keyword;
+    BOOST_CHECK( !keyword.getRecord( 0 ).getItem( 0 ).loaded() );
+    BOOST_CHECK_EQUAL( ss.str(), "PORO\n   0.25 2*0.5 1D-1 /\n" );
+
+    const auto written = Parser().parseString( ss.str() );
+    BOOST_CHECK( written.getKeyword( "PORO" ).equal( Parser().parseString( input ).getKeyword( "PORO" ), true ) );
+}
@@ -19,6 +19,7 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <thread>
 #include <boost/filesystem.hpp>
 
 #define BOOST_TEST_MODULE ScheduleTests
@@ -438,6 +439,47 @@ BOOST_AUTO_TEST_CASE(CreateScheduleDeckWellsOrderedGRUPTREE) {
         BOOST_CHECK( has_well( parent_wells2, "BW_2" ));
         BOOST_CHECK( has_well( parent_wells2, "AW_3" ));
     }
+
+    BOOST_CHECK_THROW( schedule.getChildWells2Ptr( "NO_SUCH_GROUP" , 1 ), std::invalid_argument);
+    for (const auto& group : {"FIELD", "PLATFORM", "CG1", "PG2"}) {
+        const auto& wells = schedule.getChildWells2(group, 0);
+        const auto& well_ptrs = schedule.getChildWells2Ptr(group, 0);
+        BOOST_CHECK_EQUAL( wells.size() , well_ptrs.size());
+        for (std::size_t i = 0; i < wells.size(); i++)
+            BOOST_CHECK_EQUAL( wells[i].name() , well_ptrs[i]->name());
+
+        // The flattened well lists are cached.
+        BOOST_CHECK( std::addressof(well_ptrs) == std::addressof(schedule.getChildWells2Ptr(group, 0)));
+    }
+
+    // Replacing a well is visible through the modification count, and the
+    // flattened well lists refer to the new well.
+    {
+        const auto count = schedule.modificationCount();
+        auto well = std::make_shared<Well2>(schedule.getWell2("DW_0", 0));
+        schedule.updateWell(well, 0);
+        BOOST_CHECK( schedule.modificationCount() > count );
+
+        const auto& well_ptrs = schedule.getChildWells2Ptr("CG1", 0);
+        BOOST_CHECK( std::find(well_ptrs.begin(), well_ptrs.end(), well.get()) != well_ptrs.end());
+    }
+
+    // A copy has its own cache, which can be filled concurrently.
+    {
+        const Schedule copy = schedule;
+        std::vector<std::size_t> sizes(4);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < sizes.size(); t++)
+            threads.emplace_back([&copy, &sizes, t]() { sizes[t] = copy.getChildWells2Ptr("FIELD", 0).size(); });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto& size : sizes)
+            BOOST_CHECK_EQUAL( size, 4U );
+
+        BOOST_CHECK( std::addressof(copy.getChildWells2Ptr("FIELD", 0)) != std::addressof(schedule.getChildWells2Ptr("FIELD", 0)));
+    }
     auto group_names = schedule.groupNames("P*", 0);
     BOOST_CHECK( std::find(group_names.begin(), group_names.end(), "PG1") != group_names.end() );
     BOOST_CHECK( std::find(group_names.begin(), group_names.end(), "PG2") != group_names.end() );
@@ -638,6 +680,14 @@ BOOST_AUTO_TEST_CASE(WellsIterator_HasWells_WellsReturned) {
     BOOST_CHECK_EQUAL(1U, wells_t0.size());
     const auto wells_t3 = schedule.getWells2(3);
     BOOST_CHECK_EQUAL(3U, wells_t3.size());
+
+    const auto well_ptrs_t3 = schedule.getWells2Ptr(3);
+    BOOST_CHECK_EQUAL(3U, well_ptrs_t3.size());
+    for (std::size_t i = 0; i < well_ptrs_t3.size(); i++)
+        BOOST_CHECK( well_ptrs_t3[i] == std::addressof(schedule.getWell2(wells_t3[i].name(), 3)));
+
+    BOOST_CHECK_EQUAL(3U, schedule.getWells2atEndPtr().size());
+    BOOST_CHECK_THROW(schedule.getWells2Ptr(schedule.size()), std::invalid_argument);
 }
 
 
@@ -18,7 +18,13 @@
  */
 
 #define BOOST_TEST_MODULE ParserTests
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <random>
 #include <stdexcept>
+#include <string>
 #include <boost/test/unit_test.hpp>
 
 #include "src/opm/parser/eclipse/Parser/raw/StarToken.hpp"
@@ -125,3 +131,52 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "'123*456'" ) ) );
 }
+
+BOOST_AUTO_TEST_CASE( readValueToken_fortran_numbers ) {
+    BOOST_CHECK_EQUAL( 1500.0, Opm::readValueToken<double>( std::string( "1.5D+3" ) ) );
+    BOOST_CHECK_EQUAL( 0.02, Opm::readValueToken<double>( std::string( "2d-2" ) ) );
+    BOOST_CHECK_EQUAL( 1.0, Opm::readValueToken<double>( std::string( "1." ) ) );
+    BOOST_CHECK_EQUAL( -0.5, Opm::readValueToken<double>( std::string( "-.5" ) ) );
+    BOOST_CHECK_EQUAL( 0.1, Opm::readValueToken<double>( std::string( "0.1" ) ) );
+    BOOST_CHECK_EQUAL( 1.0e-5, Opm::readValueToken<double>( std::string( "0.00001" ) ) );
+    BOOST_CHECK_EQUAL( std::numeric_limits<double>::max(),
+                       Opm::readValueToken<double>( std::string( "1.7976931348623157D308" ) ) );
+    BOOST_CHECK_EQUAL( 0.3, Opm::readValueToken<double>( std::string( "0.299999999999999988897769753748434595763683319091796875" ) ) );
+
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "1e" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "1D+" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "." ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "-" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "1.5 " ) ), std::invalid_argument );
+
+    BOOST_CHECK_EQUAL( std::numeric_limits<int>::max(), Opm::readValueToken<int>( std::string( "2147483647" ) ) );
+    BOOST_CHECK_EQUAL( std::numeric_limits<int>::min(), Opm::readValueToken<int>( std::string( "-2147483648" ) ) );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( std::string( "2147483648" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( std::string( "-" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<int>( std::string( "1e3" ) ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( readValueToken_roundtrip ) {
+    std::mt19937_64 rng( 42 );
+    for (int i = 0; i < 100000; i++) {
+        const auto bits = rng();
+        double value;
+        std::memcpy( &value, &bits, sizeof value );
+        if (value != value || value - value != 0)
+            continue;
+
+        char buffer[32];
+        std::snprintf( buffer, sizeof buffer, (i % 2 == 0) ? "%.17g" : "%.16E", value );
+        std::string token( buffer );
+        if (i % 3 == 0) {
+            for (auto& c : token)
+                if (c == 'e' || c == 'E')
+                    c = 'D';
+        }
+
+        BOOST_REQUIRE_EQUAL( value, Opm::readValueToken<double>( token ) );
+
+        const auto int_value = static_cast<int>( static_cast<std::int32_t>( bits >> 32 ) );
+        BOOST_REQUIRE_EQUAL( int_value, Opm::readValueToken<int>( std::to_string( int_value ) ) );
+    }
+}
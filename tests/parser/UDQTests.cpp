@@ -742,6 +742,19 @@ BOOST_AUTO_TEST_CASE(ELEMENTAL_UNARY_FUNCTIONS) {
         BOOST_CHECK( !result[3] );
         BOOST_CHECK_EQUAL( result[4].value(), 1);
     }
+    {
+        const auto& func = dynamic_cast<const UDQUnaryElementalFunction&>(udqft.get("SORTA"));
+        UDQSet arg_local("NAME", 4);
+        arg_local.assign(0, 2);
+        arg_local.assign(1, 3);
+        arg_local.assign(3, 1);
+
+        auto result = func.eval(arg_local);
+        BOOST_CHECK_EQUAL( result[0].value(), 2);
+        BOOST_CHECK_EQUAL( result[1].value(), 3);
+        BOOST_CHECK( !result[2] );
+        BOOST_CHECK_EQUAL( result[3].value(), 1);
+    }
 }
 
 
@@ -31,6 +31,7 @@
 #include <iostream>
 #include <math.h>
 #include <stdio.h>
+#include <thread>
 #include <tuple>
 
 using Opm::EclIO::ESmry;
@@ -354,3 +355,118 @@ BOOST_AUTO_TEST_CASE(TestESmry_4) {
 
 
 
+
+BOOST_AUTO_TEST_CASE(TestESmry_loadData) {
+
+    std::vector <float> time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref, fgor_ref, bpr_111_ref, bpr_10103_ref;
+
+    getRefSmryVect(time_ref, wgpr_prod_ref, wbhp_prod_ref, wbhp_inj_ref,fgor_ref, bpr_111_ref, bpr_10103_ref);
+
+    // vectors loaded in one pass must equal vectors loaded one by one on access
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    ESmry smry2("SPE1CASE1.SMSPEC");
+
+    std::vector<std::string> vectList = {"BPR:10,10,3", "TIME", "FGOR", "WBHP:INJ"};
+
+    BOOST_CHECK_THROW(smry1.loadData({"TIME", "XXXX"}), std::invalid_argument);
+
+    smry1.loadData(vectList);
+
+    for (const auto& name : vectList) {
+        BOOST_CHECK_EQUAL(smry1.get(name)==smry2.get(name), true);
+    }
+
+    BOOST_CHECK_EQUAL(smry1.get("TIME")==time_ref, true);
+
+    smry2.loadData();
+
+    for (const auto& name : smry2.keywordList()) {
+        BOOST_CHECK_EQUAL(smry1.get(name)==smry2.get(name), true);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestESmry_concurrentGet) {
+
+    // vectors loaded on demand from several threads at once must equal
+    // vectors loaded in one pass
+
+    const ESmry smry1("SPE1CASE1.SMSPEC");
+    ESmry smry2("SPE1CASE1.SMSPEC");
+
+    smry2.loadData();
+
+    const auto& keywords = smry1.keywordList();
+    const std::size_t numThreads = 4;
+
+    std::vector<std::vector<std::vector<float>>> results(numThreads);
+    std::vector<std::thread> threads;
+
+    for (std::size_t t = 0; t < numThreads; t++) {
+        threads.emplace_back([&smry1, &keywords, &results, t]()
+                             {
+                                 for (const auto& name : keywords) {
+                                     results[t].push_back(smry1.get(name));
+                                 }
+                             });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (std::size_t t = 0; t < numThreads; t++) {
+        BOOST_REQUIRE_EQUAL(results[t].size(), keywords.size());
+
+        for (std::size_t ind = 0; ind < keywords.size(); ind++) {
+            BOOST_CHECK_EQUAL(results[t][ind]==smry2.get(keywords[ind]), true);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(TestESmry_lodsmry) {
+
+    boost::filesystem::copy_file("SPE1CASE1.SMSPEC", "LODTEST.SMSPEC", boost::filesystem::copy_option::overwrite_if_exists);
+    boost::filesystem::copy_file("SPE1CASE1.UNSMRY", "LODTEST.UNSMRY", boost::filesystem::copy_option::overwrite_if_exists);
+
+    ESmry smry1("LODTEST.SMSPEC");
+
+    BOOST_CHECK_EQUAL(smry1.usesLodsmryFile(), false);
+
+    std::vector<float> fgor = smry1.get("FGOR");
+
+    smry1.make_lodsmry_file();
+
+    BOOST_CHECK_EQUAL(smry1.usesLodsmryFile(), true);
+    BOOST_CHECK_EQUAL(boost::filesystem::exists("LODTEST.LODSMRY"), true);
+
+    // reference to vector loaded before writing the file is still valid
+    BOOST_CHECK_EQUAL(smry1.get("FGOR")==fgor, true);
+
+    ESmry smry2("LODTEST.SMSPEC");
+    ESmry smry3("SPE1CASE1.SMSPEC");
+
+    BOOST_CHECK_EQUAL(smry2.usesLodsmryFile(), true);
+    BOOST_CHECK_EQUAL(smry3.usesLodsmryFile(), false);
+    BOOST_CHECK_EQUAL(smry2.numberOfVectors(), smry3.numberOfVectors());
+
+    for (const auto& name : smry3.keywordList()) {
+        BOOST_CHECK_EQUAL(smry2.get(name)==smry3.get(name), true);
+    }
+
+    BOOST_CHECK_EQUAL(smry2.get_at_rstep("TIME")==smry3.get_at_rstep("TIME"), true);
+
+    // result file replaced by one which is not newer than the LODSMRY file
+    const auto lodTime = boost::filesystem::last_write_time("LODTEST.LODSMRY");
+    boost::filesystem::copy_file("SPE1CASE1.UNSMRY", "LODTEST.UNSMRY", boost::filesystem::copy_option::overwrite_if_exists);
+    boost::filesystem::last_write_time("LODTEST.UNSMRY", lodTime - 1);
+
+    ESmry smry4("LODTEST.SMSPEC");
+
+    BOOST_CHECK_EQUAL(smry4.usesLodsmryFile(), false);
+    BOOST_CHECK_EQUAL(smry4.get("FGOR")==fgor, true);
+
+    for (const auto& file : {"LODTEST.SMSPEC", "LODTEST.UNSMRY", "LODTEST.LODSMRY", "LODTEST.LODSMRY.idx"}) {
+        boost::filesystem::remove(file);
+    }
+}
@@ -34,6 +34,7 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 
 #define BOOST_TEST_MODULE Test EclIO
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 
 using namespace Opm::EclIO;
@@ -356,3 +357,178 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR) {
 
 
 }
+
+BOOST_AUTO_TEST_CASE(TestEcl_Read_binary_block_boundaries) {
+
+    std::string testFile="TEST.DAT";
+
+    // array sizes chosen to end before, on and after the 1000 element
+    // (105 for CHAR) Fortran block boundaries of the binary format
+
+    std::vector<int> sizes = {1, 999, 1000, 1001, 2500};
+
+    for (int size : sizes) {
+        std::vector<int> refInte(size);
+        std::vector<float> refReal(size);
+        std::vector<double> refDoub(size);
+        std::vector<bool> refLogi(size);
+        std::vector<std::string> refChar(size);
+
+        for (int n = 0; n < size; n++) {
+            refInte[n] = n - 500;
+            refReal[n] = 0.25f * n - 100.0f;
+            refDoub[n] = 1.0e-3 * n + 3.0e10;
+            refLogi[n] = (n % 3) == 0;
+            refChar[n] = "C" + std::to_string(n % 1000);
+        }
+
+        {
+            EclOutput eclTest(testFile, false);
+
+            eclTest.write("INTE", refInte);
+            eclTest.write("REAL", refReal);
+            eclTest.write("DOUB", refDoub);
+            eclTest.write("LOGI", refLogi);
+            eclTest.write("CHAR", refChar);
+        }
+
+        EclFile file1(testFile);
+
+        BOOST_CHECK(file1.get<int>("INTE") == refInte);
+        BOOST_CHECK(file1.get<float>("REAL") == refReal);
+        BOOST_CHECK(file1.get<double>("DOUB") == refDoub);
+        BOOST_CHECK(file1.get<bool>("LOGI") == refLogi);
+        BOOST_CHECK(file1.get<std::string>("CHAR") == refChar);
+    }
+
+    if (remove(testFile.c_str())==-1) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_WriteAsFloat) {
+
+    std::string refFile="TEST_REF.DAT";
+    std::string testFile="TEST.DAT";
+
+    // double precision data written with writeAsFloat must give the same
+    // file as the data converted to float and written with write
+
+    std::vector<double> data(2500);
+
+    for (size_t n = 0; n < data.size(); n++) {
+        data[n] = 1.0 / (n + 3.0) - 100.0;
+    }
+
+    for (bool formatted : {false, true}) {
+        {
+            EclOutput eclRef(refFile, formatted);
+            eclRef.write("REAL", std::vector<float>(data.begin(), data.end()));
+        }
+
+        {
+            EclOutput eclTest(testFile, formatted);
+            eclTest.writeAsFloat("REAL", data);
+        }
+
+        BOOST_CHECK_EQUAL(compare_files(refFile, testFile), true);
+    }
+
+    if ((remove(refFile.c_str())==-1) || (remove(testFile.c_str())==-1)) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
+
+BOOST_AUTO_TEST_CASE(TestEcl_Index) {
+
+    std::string testFile="TEST.DAT";
+    std::string indexFile=EclFile::indexFileName(testFile);
+
+    std::vector<int> refInte = {1, 2, 3};
+    std::vector<double> refDoub(2500, 1.5);
+
+    {
+        EclOutput eclTest(testFile, false);
+
+        eclTest.write("SEQNUM", std::vector<int>{ 1 });
+        eclTest.write("INTE", refInte);
+        eclTest.write("DOUB", refDoub);
+        eclTest.write("ENDSOL", std::vector<char>());
+    }
+
+    EclFile file1(testFile);
+    file1.writeIndex();
+
+    BOOST_CHECK(std::ifstream(indexFile).good());
+
+    // index used in place of header scan, must give identical result
+
+    {
+        EclFile file2(testFile);
+        auto list1 = file1.getList();
+        auto list2 = file2.getList();
+
+        BOOST_CHECK(list1 == list2);
+        BOOST_CHECK(file2.get<int>("INTE") == refInte);
+        BOOST_CHECK(file2.get<double>("DOUB") == refDoub);
+        BOOST_CHECK(file2.hasKey("ENDSOL"));
+    }
+
+    // stale index (file size changed) must be ignored
+
+    {
+        EclOutput eclTest(testFile, false, std::ios::app);
+        eclTest.write("EXTRA", refInte);
+    }
+
+    {
+        EclFile file3(testFile);
+
+        BOOST_CHECK_EQUAL(file3.getList().size(), file1.getList().size() + 1);
+        BOOST_CHECK(file3.get<int>("EXTRA") == refInte);
+        BOOST_CHECK(file3.get<double>("DOUB") == refDoub);
+    }
+
+    // updating the index only scans the appended arrays
+
+    EclFile::updateIndex(testFile);
+
+    {
+        EclFile file4(testFile);
+        auto list4 = file4.getList();
+
+        BOOST_CHECK_EQUAL(list4.size(), file1.getList().size() + 1);
+        BOOST_CHECK(std::get<0>(list4.back()) == "EXTRA");
+        BOOST_CHECK(file4.get<int>("EXTRA") == refInte);
+        BOOST_CHECK(file4.get<double>("DOUB") == refDoub);
+    }
+
+    // index of a rewritten file with same size and modification time must
+    // be ignored, since the last indexed header no longer matches
+
+    {
+        const auto mtime = boost::filesystem::last_write_time(testFile);
+
+        {
+            EclOutput eclTest(testFile, false);
+
+            eclTest.write("SEQNUM", std::vector<int>{ 1 });
+            eclTest.write("INTE", refInte);
+            eclTest.write("DOUB", refDoub);
+            eclTest.write("ENDSOL", std::vector<char>());
+            eclTest.write("OTHER", refInte);
+        }
+
+        boost::filesystem::last_write_time(testFile, mtime);
+
+        EclFile file5(testFile);
+
+        BOOST_CHECK(file5.hasKey("OTHER"));
+        BOOST_CHECK(!file5.hasKey("EXTRA"));
+        BOOST_CHECK(file5.get<int>("OTHER") == refInte);
+    }
+
+    if ((remove(testFile.c_str())==-1) || (remove(indexFile.c_str())==-1)) {
+        std::cout << " > Warning! temporary file was not deleted" << std::endl;
+    };
+}
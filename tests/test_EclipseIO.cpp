@@ -39,11 +39,18 @@
 #include <opm/io/eclipse/EGrid.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/OpmLog/StreamLog.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
+#include <boost/filesystem.hpp>
+
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <numeric>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -230,6 +237,105 @@ time_t ecl_util_make_date( const int day, const int month, const int year )
     return static_cast<time_t>(asTimeT(Opm::TimeStampUTC{ymd}));
 }
 
+template <typename T>
+bool sameArray( EclIO::EclFile& expect, EclIO::EclFile& actual, int arrIndex ) {
+    return expect.get<T>(arrIndex) == actual.get<T>(arrIndex);
+}
+
+void checkSameContents( const std::string& expectFile, const std::string& actualFile ) {
+    EclIO::EclFile expect { expectFile };
+    EclIO::EclFile actual { actualFile };
+
+    const auto expectArrays = expect.getList();
+    const auto actualArrays = actual.getList();
+
+    BOOST_REQUIRE_EQUAL( expectArrays.size(), actualArrays.size() );
+
+    for (std::size_t i = 0; i < expectArrays.size(); ++i) {
+        const auto& name = std::get<0>(expectArrays[i]);
+        const auto  type = std::get<1>(expectArrays[i]);
+        const auto  arrIndex = static_cast<int>(i);
+
+        BOOST_CHECK_EQUAL( name, std::get<0>(actualArrays[i]) );
+        BOOST_REQUIRE( type == std::get<1>(actualArrays[i]) );
+
+        bool same = true;
+        switch (type) {
+        case EclIO::INTE: same = sameArray<int>(expect, actual, arrIndex); break;
+        case EclIO::REAL: same = sameArray<float>(expect, actual, arrIndex); break;
+        case EclIO::DOUB: same = sameArray<double>(expect, actual, arrIndex); break;
+        case EclIO::LOGI: same = sameArray<bool>(expect, actual, arrIndex); break;
+        case EclIO::CHAR: same = sameArray<std::string>(expect, actual, arrIndex); break;
+        case EclIO::MESS: break;
+        }
+
+        BOOST_CHECK_MESSAGE( same, "Array " + name + " differs between "
+                             + expectFile + " and " + actualFile );
+    }
+}
+
+/*
+  Non-unified output, such that every report step is written to separate
+  restart and summary files.
+*/
+struct AsyncSetup {
+    AsyncSetup()
+        : deck     { Parser().parseString( deckString ) }
+        , es       { deck }
+        , grid     { es.getInputGrid() }
+        , schedule { deck, grid, es.get3DProperties(), es.runspec() }
+        , summary_config { deck, schedule, es.getTableManager() }
+    {
+        es.getIOConfig().setBaseName( "FOO" );
+    }
+
+    void writeStep( EclipseIO& eclWriter, int report_step ) const {
+        const auto start_time = ecl_util_make_date( 10, 10, 2008 );
+        const auto step_time  = ecl_util_make_date( 10 + report_step, 11, 2008 );
+
+        SummaryState st(std::chrono::system_clock::now());
+        RestartValue restart_value( createBlackoilState( report_step, 3 * 3 * 3 ), data::Wells{} );
+
+        eclWriter.writeTimeStep( st, report_step, false, step_time - start_time, restart_value );
+    }
+
+    static constexpr const char* deckString =
+        "RUNSPEC\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "METRIC\n"
+        "DIMENS\n"
+        "3 3 3/\n"
+        "GRID\n"
+        "PORO\n"
+        "27*0.3 /\n"
+        "PERMX\n"
+        "27*1 /\n"
+        "DXV\n"
+        "1.0 2.0 3.0 /\n"
+        "DYV\n"
+        "4.0 5.0 6.0 /\n"
+        "DZV\n"
+        "7.0 8.0 9.0 /\n"
+        "TOPS\n"
+        "9*100 /\n"
+        "PROPS\n"
+        "SOLUTION\n"
+        "RPTRST\n"
+        "BASIC=2\n"
+        "/\n"
+        "SCHEDULE\n"
+        "TSTEP\n"
+        "1.0 2.0 3.0 4.0 /\n";
+
+    Deck deck;
+    EclipseState es;
+    EclipseGrid grid;
+    Schedule schedule;
+    SummaryConfig summary_config;
+};
+
 } // Anonymous namespace
 
 BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
@@ -274,7 +380,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         "'PROD' 'G' 3 3 1000 'OIL' /\n"
         "/\n";
 
-    auto write_and_check = [&]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&]( int first = 1, int last = 5, bool async = false ) {
         auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         auto& eclGrid = es.getInputGrid();
@@ -284,6 +390,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        eclWriter.setAsyncOutput( async );
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -324,6 +431,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
                                      first_step - start_time,
                                      restart_value);
 
+            eclWriter.flush();
             checkRestartFile( i );
         }
 
@@ -376,4 +484,107 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
      * the file
      */
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
+
+    /* asynchronous output produces the same files */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5 ) );
+    for (const auto& ext : { ".UNRST", ".SMSPEC", ".UNSMRY" })
+        boost::filesystem::copy_file( std::string("FOO") + ext, std::string("SYNC") + ext,
+                                      boost::filesystem::copy_option::overwrite_if_exists );
+
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true ) );
+    for (const auto& ext : { ".UNRST", ".SMSPEC", ".UNSMRY" })
+        checkSameContents( std::string("SYNC") + ext, std::string("FOO") + ext );
+}
+
+BOOST_AUTO_TEST_CASE(AsyncOutputErrors) {
+    WorkArea work_area("test_ecl_async_errors");
+    const AsyncSetup setup;
+
+    /*
+      A directory in place of the restart file of report step 2 makes
+      the writer fail on that step, while the other steps succeed.
+    */
+    boost::filesystem::create_directory( "FOO.X0002" );
+
+    /* error is rethrown from flush(), and only once */
+    {
+        EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config );
+        eclWriter.setAsyncOutput( true, 1 );
+
+        setup.writeStep( eclWriter, 1 );
+        setup.writeStep( eclWriter, 2 );
+        BOOST_CHECK_THROW( eclWriter.flush(), std::runtime_error );
+        BOOST_CHECK_NO_THROW( eclWriter.flush() );
+        BOOST_CHECK( boost::filesystem::exists( "FOO.X0001" ) );
+
+        setup.writeStep( eclWriter, 3 );
+        eclWriter.flush();
+        BOOST_CHECK( boost::filesystem::exists( "FOO.X0003" ) );
+        boost::filesystem::remove( "FOO.X0003" );
+    }
+
+    /*
+      With a single pending step the step following the failing one
+      waits for the writer and receives its error without being queued.
+    */
+    {
+        EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config );
+        eclWriter.setAsyncOutput( true, 1 );
+
+        setup.writeStep( eclWriter, 2 );
+        BOOST_CHECK_THROW( setup.writeStep( eclWriter, 3 ), std::runtime_error );
+        BOOST_CHECK_NO_THROW( eclWriter.flush() );
+        BOOST_CHECK( !boost::filesystem::exists( "FOO.X0003" ) );
+    }
+
+    /*
+      Steps queued after the failing one are discarded. Whether the error
+      surfaces from writeTimeStep() or flush() depends on the progress of
+      the writer.
+    */
+    {
+        EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config );
+        eclWriter.setAsyncOutput( true, 3 );
+
+        BOOST_CHECK_THROW( {
+            setup.writeStep( eclWriter, 2 );
+            setup.writeStep( eclWriter, 3 );
+            setup.writeStep( eclWriter, 4 );
+            eclWriter.flush();
+        }, std::runtime_error );
+
+        BOOST_CHECK_NO_THROW( eclWriter.flush() );
+        BOOST_CHECK( !boost::filesystem::exists( "FOO.X0003" ) );
+        BOOST_CHECK( !boost::filesystem::exists( "FOO.X0004" ) );
+    }
+
+    /* output is synchronous again after disabling asynchronous output */
+    {
+        EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config );
+        eclWriter.setAsyncOutput( true );
+
+        setup.writeStep( eclWriter, 1 );
+        eclWriter.setAsyncOutput( false );
+
+        boost::filesystem::remove( "FOO.X0001" );
+        setup.writeStep( eclWriter, 1 );
+        BOOST_CHECK( boost::filesystem::exists( "FOO.X0001" ) );
+        BOOST_CHECK_THROW( setup.writeStep( eclWriter, 2 ), std::runtime_error );
+    }
+
+    /* an error still pending on destruction is logged */
+    {
+        std::ostringstream log;
+        OpmLog::addBackend( "ASYNC_ERRORS", std::make_shared<StreamLog>( log, Log::MessageType::Error ) );
+
+        {
+            EclipseIO eclWriter( setup.es, setup.grid, setup.schedule, setup.summary_config );
+            eclWriter.setAsyncOutput( true );
+
+            setup.writeStep( eclWriter, 2 );
+        }
+
+        OpmLog::removeBackend( "ASYNC_ERRORS" );
+        BOOST_CHECK( log.str().find( "Asynchronous output failed" ) != std::string::npos );
+    }
 }
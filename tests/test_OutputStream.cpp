@@ -33,6 +33,7 @@
 #include <algorithm>
 #include <chrono>
 #include <ctime>
+#include <fstream>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -531,6 +532,9 @@ BOOST_AUTO_TEST_CASE(Unformatted_Unified)
         const auto fname = ::Opm::EclIO::OutputStream::
             outputFileName(rset, "UNRST");
 
+        // Array header index written when closing unified restart stream
+        BOOST_CHECK(std::ifstream(::Opm::EclIO::EclFile::indexFileName(fname)).good());
+
         auto rst = ::Opm::EclIO::ERst{fname};
 
         BOOST_CHECK(rst.hasReportStepNumber( 1));
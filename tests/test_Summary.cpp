@@ -22,6 +22,7 @@
 #define BOOST_TEST_MODULE Wells
 #include <boost/test/unit_test.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/filesystem.hpp>
 
 #include <cstddef>
 #include <exception>
@@ -608,6 +609,35 @@ BOOST_AUTO_TEST_CASE(udq_keywords) {
 #endif
 }
 
+BOOST_AUTO_TEST_CASE(eval_threads) {
+    setup cfg( "test_summary_eval_threads" );
+
+    // Evaluating with several threads must give the same summary state as
+    // serial evaluation.
+    auto evaluate = [&cfg](const int num_threads) {
+        out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+        writer.set_eval_threads( num_threads );
+
+        SummaryState st(std::chrono::system_clock::now());
+        for (int step = 0; step < 3; ++step)
+            writer.eval( st, step, step * day, cfg.es, cfg.schedule, cfg.wells , {});
+
+        return st;
+    };
+
+    const auto serial = evaluate(1);
+    const auto threaded = evaluate(4);
+
+    BOOST_CHECK_EQUAL( serial.size(), threaded.size() );
+    for (const auto& value : serial) {
+        BOOST_REQUIRE( threaded.has(value.first) );
+        BOOST_CHECK_EQUAL( value.second, threaded.get(value.first) );
+    }
+
+    BOOST_CHECK_THROW( out::Summary( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name ).set_eval_threads(0),
+                       std::invalid_argument );
+}
+
 BOOST_AUTO_TEST_CASE(group_keywords) {
     setup cfg( "test_summary_group" );
 
@@ -1027,6 +1057,32 @@ BOOST_AUTO_TEST_CASE(report_steps_time) {
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(unreadable_output_directory) {
+    setup cfg( "test_summary_unreadable_output_directory" );
+
+    cfg.ta.makeSubDir( "PATH" );
+    cfg.name = "PATH/CASE";
+
+    {
+        SummaryState st(std::chrono::system_clock::now());
+        auto writer = std::make_unique<out::Summary>( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+        writer->eval( st, 1, 1 * day, cfg.es, cfg.schedule, cfg.wells, {});
+        writer->add_timestep( st, 1);
+        writer->write();
+
+        // The output directory can not be examined when the unified
+        // summary file is indexed on destruction; the index is skipped.
+        boost::filesystem::rename( "PATH", "PATH_MOVED" );
+        boost::filesystem::create_symlink( "PATH", "PATH" );
+
+        BOOST_CHECK_NO_THROW( writer.reset() );
+    }
+
+    boost::filesystem::remove( "PATH" );
+    boost::filesystem::rename( "PATH_MOVED", "PATH" );
+    BOOST_CHECK( !boost::filesystem::exists( "PATH/CASE.UNSMRY.idx" ) );
+}
+
 BOOST_AUTO_TEST_CASE(skip_unknown_var) {
     setup cfg( "test_summary_skip_unknown_var" );
 
@@ -3267,6 +3323,119 @@ BOOST_AUTO_TEST_CASE(serialize_sumary_state) {
 }
 
 
+BOOST_AUTO_TEST_CASE(serialize_delta_sumary_state) {
+    SummaryState st(std::chrono::system_clock::now());
+    SummaryState st2(std::chrono::system_clock::now());
+    st.update("FOPT", 100);
+    st.update_well_var("OP_1", "WOPR", 1000);
+    st2.update("FGPT", 50);
+    st2.update_well_var("OP_2", "WGOR", 0.67);
+
+    const auto full = st.serialize();
+    st2.deserialize(full);
+    BOOST_CHECK( equal(st, st2));
+    auto known = st.num_keys();
+
+    // Values only; no new keys.
+    st.update_elapsed(100);
+    st.update("FOPT", 100);
+    st.update_well_var("OP_1", "WOPR", 2000);
+    const auto values_only = st.serialize_delta(known);
+    BOOST_CHECK( values_only.size() < full.size() );
+    st2.deserialize(values_only);
+    BOOST_CHECK( equal(st, st2));
+    BOOST_CHECK_EQUAL( st2.get("FOPT"), 200);
+    BOOST_CHECK_EQUAL( st2.get_well_var("OP_1", "WOPR"), 2000);
+    BOOST_CHECK( !st2.has("FGPT") );
+    BOOST_CHECK( !st2.has_well_var("OP_2", "WGOR") );
+
+    // New keys are appended to the dictionary.
+    st.update_well_var("OP_3", "WOPR", 10);
+    st.update_group_var("G1", "GOPR", 1000);
+    st2.deserialize(st.serialize_delta(known));
+    known = st.num_keys();
+    BOOST_CHECK( equal(st, st2));
+    BOOST_CHECK_EQUAL( st2.get_group_var("G1", "GOPR"), 1000);
+
+    // Repeated deltas reproduce the state exactly, including totals.
+    for (int step = 0; step < 3; step++) {
+        st.update("FOPT", 100);
+        st2.deserialize(st.serialize_delta(known));
+        BOOST_CHECK( equal(st, st2));
+    }
+    BOOST_CHECK_EQUAL( st2.get("FOPT"), 500);
+
+    // A delta which does not follow a buffer from the same sender is rejected.
+    SummaryState st3(std::chrono::system_clock::now());
+    BOOST_CHECK_THROW( st3.deserialize(st.serialize_delta(known)), std::invalid_argument);
+    BOOST_CHECK_THROW( st.serialize_delta(st.num_keys() + 1), std::invalid_argument);
+
+    auto truncated = st.serialize();
+    truncated.resize(truncated.size() / 2);
+    BOOST_CHECK_THROW( st3.deserialize(truncated), std::invalid_argument);
+
+    auto unknown_version = st.serialize();
+    unknown_version[0] += 1;
+    BOOST_CHECK_THROW( st3.deserialize(unknown_version), std::invalid_argument);
+}
+
+
+BOOST_AUTO_TEST_CASE(SummaryState_handles) {
+    SummaryState st(std::chrono::system_clock::now());
+
+    const auto fopt = st.handle("FOPT");
+    BOOST_CHECK_EQUAL( st.handle("FOPT"), fopt );
+    BOOST_CHECK( !st.has_value(fopt) );
+    BOOST_CHECK( !st.has("FOPT") );
+
+    st.update_value(fopt, 100);
+    BOOST_CHECK( st.has_value(fopt) );
+    BOOST_CHECK_EQUAL( st.get_value(fopt), 100 );
+    BOOST_CHECK_EQUAL( st.get("FOPT"), 100 );
+
+    // Totals accumulate through the handle as well.
+    st.update_value(fopt, 50);
+    BOOST_CHECK_EQUAL( st.get_value(fopt), 150 );
+
+    st.update("FOPT", 50);
+    BOOST_CHECK_EQUAL( st.get_value(fopt), 200 );
+
+    // Well and group handles are equivalent to the specialized updates.
+    const auto wopr = st.well_var_handle("OP_1", "WOPR");
+    BOOST_CHECK_EQUAL( st.handle("WOPR:OP_1"), wopr );
+    BOOST_CHECK( !st.has_well_var("OP_1", "WOPR") );
+    st.update_value(wopr, 1000);
+    BOOST_CHECK( st.has_well_var("OP_1", "WOPR") );
+    BOOST_CHECK_EQUAL( st.get_well_var("OP_1", "WOPR"), 1000 );
+    BOOST_CHECK_EQUAL( st.get("WOPR:OP_1"), 1000 );
+    BOOST_CHECK_EQUAL( st.wells("WOPR").size(), 1 );
+
+    const auto ggor = st.group_var_handle("G1", "GGOR");
+    st.update_value(ggor, 0.67);
+    BOOST_CHECK_EQUAL( st.get_group_var("G1", "GGOR"), 0.67 );
+    BOOST_CHECK_EQUAL( st.get_value(ggor), 0.67 );
+
+    // Iteration only visits keys with a value.
+    st.handle("FGPT");
+    std::size_t count = 0;
+    for (auto it = st.begin(); it != st.end(); ++it) {
+        BOOST_CHECK( it->first != "FGPT" );
+        BOOST_CHECK_EQUAL( it->second, st.get(it->first) );
+        ++count;
+    }
+    BOOST_CHECK_EQUAL( count, st.size() );
+
+    // Handles remain valid across deserialize(), copies get a new instance id.
+    SummaryState st2(std::chrono::system_clock::now());
+    const auto fopt2 = st2.handle("FOPT");
+    st2.deserialize(st.serialize());
+    BOOST_CHECK_EQUAL( st2.get_value(fopt2), 200 );
+
+    const auto copy = st;
+    BOOST_CHECK( copy.instance_id() != st.instance_id() );
+    BOOST_CHECK( st2.instance_id() != st.instance_id() );
+}
+
 BOOST_AUTO_TEST_CASE(SummaryState__TIME) {
     struct tm ts;
     ts.tm_year = 100;